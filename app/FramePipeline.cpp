@@ -0,0 +1,226 @@
+/* Copyright (c) 2020 Xperi Corporation (and its subsidiaries). All rights reserved.
+ 
+Permission is hereby granted, free of charge, to any person obtaining
+a copy of this software and associated documentation files (the "Software"),
+to deal in the Software without restriction, including without limitation
+the rights to use, copy, modify, merge, publish, distribute, sublicense,
+and/or sell copies of the Software, and to permit persons to whom the
+Software is furnished to do so, subject to the following conditions:
+ 
+The above copyright notice and this permission notice shall be included
+in all copies or substantial portions of the Software.
+ 
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ 
+IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT
+OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR
+THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include "FramePipeline.h"
+
+// Frames parsed ahead of the one being validated, a power of 2
+static const uint32_t kRingSize = 8;
+
+// Rounds a waiting thread yields before blocking
+static const uint32_t kSpinCount = 64;
+
+// Constructor
+FramePipeline::FramePipeline()
+    : pushCount_(0), takeCount_(0), parsingEnded_(false), stopRequested_(false),
+    takerWaiting_(false), parserWaiting_(false)
+{
+    parser_ = nullptr;
+    inputStream_ = nullptr;
+    ringMask_ = kRingSize - 1;
+    parseResult_ = kIABNoError;
+}
+
+// Destructor
+FramePipeline::~FramePipeline()
+{
+    Stop();
+}
+
+// FramePipeline::Start() implementation
+void FramePipeline::Start(IABParserInterface* iParser, std::istream* iInputStream)
+{
+    Stop();
+    
+    parser_ = iParser;
+    inputStream_ = iInputStream;
+    ring_.assign(kRingSize, nullptr);
+    pushCount_.store(0);
+    takeCount_.store(0);
+    parsingEnded_.store(false);
+    parseResult_ = kIABNoError;
+    stopRequested_.store(false);
+    takerWaiting_.store(false);
+    parserWaiting_.store(false);
+    
+    parserThread_ = std::thread(&FramePipeline::ParseFrames, this);
+}
+
+// FramePipeline::TakeNextFrame() implementation
+bool FramePipeline::TakeNextFrame(IABFrameInterface*& oFrame)
+{
+    oFrame = nullptr;
+    
+    uint32_t takeCount = takeCount_.load(std::memory_order_relaxed);
+    
+    // Wait for a frame, or for parsing to end
+    for (uint32_t spin = 0; (takeCount == pushCount_.load(std::memory_order_acquire)) && !parsingEnded_.load(std::memory_order_acquire); spin++)
+    {
+        if (spin < kSpinCount)
+        {
+            std::this_thread::yield();
+            continue;
+        }
+        
+        // The parser thread checks takerWaiting_ after each push, and signals under mutex_
+        std::unique_lock<std::mutex> lock(mutex_);
+        takerWaiting_.store(true);
+        
+        while ((takeCount == pushCount_.load()) && !parsingEnded_.load())
+        {
+            frameCondition_.wait(lock);
+        }
+        
+        takerWaiting_.store(false);
+    }
+    
+    // No more frames, unless the last one was pushed just before parsing ended
+    if (takeCount == pushCount_.load(std::memory_order_acquire))
+    {
+        return false;
+    }
+    
+    oFrame = ring_[takeCount & ringMask_];
+    ring_[takeCount & ringMask_] = nullptr;
+    
+    // Frees the slot for the parser thread
+    takeCount_.store(takeCount + 1);
+    Signal(parserWaiting_, slotCondition_);
+    
+    return true;
+}
+
+// FramePipeline::GetParseResult() implementation
+iabError FramePipeline::GetParseResult() const
+{
+    return parseResult_;
+}
+
+// FramePipeline::Stop() implementation
+void FramePipeline::Stop()
+{
+    stopRequested_.store(true);
+    
+    {
+        // The parser thread checks stopRequested_ under mutex_ before blocking
+        std::lock_guard<std::mutex> lock(mutex_);
+        slotCondition_.notify_one();
+    }
+    
+    if (parserThread_.joinable())
+    {
+        parserThread_.join();
+    }
+    
+    for (std::vector<IABFrameInterface*>::iterator iter = ring_.begin(); iter != ring_.end(); iter++)
+    {
+        if (*iter)
+        {
+            IABFrameInterface::Delete(*iter);
+            *iter = nullptr;
+        }
+    }
+}
+
+// FramePipeline::ParseFrames() implementation
+void FramePipeline::ParseFrames()
+{
+    iabError returnCode = kIABNoError;
+    uint32_t pushCount = 0;
+    
+    while (!stopRequested_.load(std::memory_order_relaxed))
+    {
+        // Wait for a free slot
+        for (uint32_t spin = 0; (pushCount - takeCount_.load(std::memory_order_acquire)) >= kRingSize; spin++)
+        {
+            if (stopRequested_.load(std::memory_order_relaxed))
+            {
+                return;
+            }
+            
+            if (spin < kSpinCount)
+            {
+                std::this_thread::yield();
+                continue;
+            }
+            
+            // The validating thread checks parserWaiting_ after each take, and signals under mutex_
+            std::unique_lock<std::mutex> lock(mutex_);
+            parserWaiting_.store(true);
+            
+            while (((pushCount - takeCount_.load()) >= kRingSize) && !stopRequested_.load())
+            {
+                slotCondition_.wait(lock);
+            }
+            
+            parserWaiting_.store(false);
+        }
+        
+        returnCode = parser_->ParseIABFrame();
+        
+        if (kIABNoError != returnCode)
+        {
+            break;
+        }
+        
+        // A frame that cannot be released is passed as nullptr, for the validating thread to report
+        IABFrameInterface* frame = nullptr;
+        
+        if (kIABNoError != parser_->GetIABFrameReleased(frame))
+        {
+            frame = nullptr;
+        }
+        
+        ring_[pushCount & ringMask_] = frame;
+        pushCount++;
+        pushCount_.store(pushCount);
+        Signal(takerWaiting_, frameCondition_);
+        
+        if (nullptr == frame)
+        {
+            break;
+        }
+        
+        if ((inputStream_ != nullptr) && inputStream_->eof())
+        {
+            // Finished processing
+            break;
+        }
+    }
+    
+    parseResult_ = returnCode;
+    parsingEnded_.store(true);
+    Signal(takerWaiting_, frameCondition_);
+}
+
+// FramePipeline::Signal() implementation
+void FramePipeline::Signal(std::atomic<bool>& iWaiting, std::condition_variable& iCondition)
+{
+    // The waiting side sets iWaiting before checking the ring, and this side checks iWaiting after
+    // updating it, both sequentially consistent: either the waiting side sees the update, or it is
+    // signalled. Taking mutex_ makes sure it is blocked by then, or not yet checking.
+    if (iWaiting.load())
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        iCondition.notify_one();
+    }
+}
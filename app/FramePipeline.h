@@ -0,0 +1,133 @@
+/* Copyright (c) 2020 Xperi Corporation (and its subsidiaries). All rights reserved.
+ 
+Permission is hereby granted, free of charge, to any person obtaining
+a copy of this software and associated documentation files (the "Software"),
+to deal in the Software without restriction, including without limitation
+the rights to use, copy, modify, merge, publish, distribute, sublicense,
+and/or sell copies of the Software, and to permit persons to whom the
+Software is furnished to do so, subject to the following conditions:
+ 
+The above copyright notice and this permission notice shall be included
+in all copies or substantial portions of the Software.
+ 
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ 
+IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT
+OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR
+THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+
+#ifndef FRAMEPIPELINE_H_
+#define FRAMEPIPELINE_H_
+
+#include <atomic>
+#include <condition_variable>
+#include <iostream>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "IABElementsAPI.h"
+#include "IABParserAPI.h"
+
+#ifdef USE_MDA_NULLPTR
+/* support lack of nullptr on older C++ compilers such as g++-4.4.7 */
+#include "nullptrOldCompilers.h"
+#endif
+
+using namespace SMPTE::ImmersiveAudioBitstream;
+
+/**
+ *
+ * Runs an IABParser in its own thread, ahead of the thread validating its frames.
+ *
+ * The parser thread parses frames one after the other and passes each one, taken over with
+ * GetIABFrameReleased(), through a bounded single-producer/single-consumer ring to the thread
+ * calling TakeNextFrame(). When the ring is full the parser thread waits for the validating
+ * thread to take a frame, so that at most a ring's worth of frames is parsed ahead.
+ *
+ * The ring is lock-free on its fast path only. Its indices are atomics, and no lock is taken
+ * while neither thread has to wait. A thread that has to wait, on a full or an empty ring, yields
+ * for a few rounds and then blocks on a condition variable under a mutex. The other thread then
+ * takes the mutex to signal it.
+ *
+ * Parsing ends at the first ParseIABFrame() error, which includes the end of the bitstream, or
+ * when the input stream, if any, reaches end of file after a frame. TakeNextFrame() then returns
+ * false once all frames before it have been taken, and GetParseResult() gives the reason.
+ *
+ */
+class FramePipeline
+{
+    
+public:
+    
+    // Constructor
+    FramePipeline();
+    
+    // Destructor, stops the parser thread
+    ~FramePipeline();
+    
+    // Starts parsing with iParser, which is used only by the parser thread until Stop(). When
+    // iInputStream is not nullptr, parsing also ends when it reaches end of file after a frame.
+    void Start(IABParserInterface* iParser, std::istream* iInputStream);
+    
+    // Waits for the next parsed frame and takes it over; caller deletes it after use. oFrame is
+    // nullptr if the parser could not release a parsed frame.
+    // Returns false once parsing has ended and all frames before that have been taken.
+    bool TakeNextFrame(IABFrameInterface*& oFrame);
+    
+    // Result of the ParseIABFrame() call that ended parsing, or kIABNoError if parsing ended at the
+    // end of the input stream. Valid after TakeNextFrame() returned false.
+    iabError GetParseResult() const;
+    
+    // Stops and joins the parser thread, deleting frames not taken
+    void Stop();
+    
+private:
+    
+    // Not copyable
+    FramePipeline(const FramePipeline&);
+    FramePipeline& operator=(const FramePipeline&);
+    
+    // Parser thread body
+    void ParseFrames();
+    
+    // Wakes the thread blocked on iCondition, if iWaiting says there is one
+    void Signal(std::atomic<bool>& iWaiting, std::condition_variable& iCondition);
+    
+    // Parser and input stream, see Start()
+    IABParserInterface*                 parser_;
+    std::istream*                       inputStream_;
+    
+    // Frame ring, slot of frame N at N & ringMask_
+    std::vector<IABFrameInterface*>     ring_;
+    uint32_t                            ringMask_;
+    
+    // Frames pushed by the parser thread, and taken by the validating thread
+    std::atomic<uint32_t>               pushCount_;
+    std::atomic<uint32_t>               takeCount_;
+    
+    // Set by the parser thread when parsing ended, parseResult_ written before it
+    std::atomic<bool>                   parsingEnded_;
+    iabError                            parseResult_;
+    
+    // Set by Stop() for the parser thread to end early
+    std::atomic<bool>                   stopRequested_;
+    
+    // Blocking waits, once spinning is over. The validating thread waits on frameCondition_ for a
+    // frame or the end of parsing, the parser thread on slotCondition_ for a free slot or Stop().
+    // Each sets its flag while blocked, so that the other only signals when needed.
+    std::mutex                          mutex_;
+    std::condition_variable             frameCondition_;
+    std::condition_variable             slotCondition_;
+    std::atomic<bool>                   takerWaiting_;
+    std::atomic<bool>                   parserWaiting_;
+    
+    std::thread                         parserThread_;
+};
+
+#endif /* FRAMEPIPELINE_H_ */
@@ -0,0 +1,112 @@
+/* Copyright (c) 2020 Xperi Corporation (and its subsidiaries). All rights reserved.
+ 
+Permission is hereby granted, free of charge, to any person obtaining
+a copy of this software and associated documentation files (the "Software"),
+to deal in the Software without restriction, including without limitation
+the rights to use, copy, modify, merge, publish, distribute, sublicense,
+and/or sell copies of the Software, and to permit persons to whom the
+Software is furnished to do so, subject to the following conditions:
+ 
+The above copyright notice and this permission notice shall be included
+in all copies or substantial portions of the Software.
+ 
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ 
+IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT
+OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR
+THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#include "MappedInputFile.h"
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+// Constructor
+MappedInputFile::MappedInputFile()
+{
+    data_ = nullptr;
+    size_ = 0;
+}
+
+// Destructor
+MappedInputFile::~MappedInputFile()
+{
+    Close();
+}
+
+// MappedInputFile::Open() implementation
+bool MappedInputFile::Open(const std::string& iFileName)
+{
+    Close();
+    
+#ifndef _WIN32
+    int fd = open(iFileName.c_str(), O_RDONLY);
+    
+    if (fd < 0)
+    {
+        return false;
+    }
+    
+    struct stat fileStat;
+    
+    if ((fstat(fd, &fileStat) != 0) || !S_ISREG(fileStat.st_mode) || (fileStat.st_size <= 0))
+    {
+        close(fd);
+        return false;
+    }
+    
+    size_t fileSize = static_cast<size_t>(fileStat.st_size);
+    void* mapping = mmap(nullptr, fileSize, PROT_READ, MAP_PRIVATE, fd, 0);
+    
+    // The mapping stays valid after the descriptor is closed
+    close(fd);
+    
+    if (mapping == MAP_FAILED)
+    {
+        return false;
+    }
+    
+    // Frames are parsed front to back, let the kernel read ahead aggressively and drop pages behind
+    madvise(mapping, fileSize, MADV_SEQUENTIAL);
+    
+    data_ = static_cast<const char*>(mapping);
+    size_ = fileSize;
+    
+    return true;
+#else
+    (void)iFileName;
+    return false;
+#endif
+}
+
+// MappedInputFile::Close() implementation
+void MappedInputFile::Close()
+{
+#ifndef _WIN32
+    if (data_)
+    {
+        munmap(const_cast<char*>(data_), size_);
+    }
+#endif
+    
+    data_ = nullptr;
+    size_ = 0;
+}
+
+const char* MappedInputFile::GetData() const
+{
+    return data_;
+}
+
+size_t MappedInputFile::GetSize() const
+{
+    return size_;
+}
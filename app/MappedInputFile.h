@@ -0,0 +1,75 @@
+/* Copyright (c) 2020 Xperi Corporation (and its subsidiaries). All rights reserved.
+ 
+Permission is hereby granted, free of charge, to any person obtaining
+a copy of this software and associated documentation files (the "Software"),
+to deal in the Software without restriction, including without limitation
+the rights to use, copy, modify, merge, publish, distribute, sublicense,
+and/or sell copies of the Software, and to permit persons to whom the
+Software is furnished to do so, subject to the following conditions:
+ 
+The above copyright notice and this permission notice shall be included
+in all copies or substantial portions of the Software.
+ 
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ 
+IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT
+OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR
+THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef MAPPEDINPUTFILE_H_
+#define MAPPEDINPUTFILE_H_
+
+#include <string>
+#include <stddef.h>
+
+#ifdef USE_MDA_NULLPTR
+/* support lack of nullptr on older C++ compilers such as g++-4.4.7 */
+#include "nullptrOldCompilers.h"
+#endif
+
+/**
+ *
+ * Read-only memory mapping of an input file.
+ *
+ * The whole file is mapped and its contents are parsed in place, avoiding the read() copies of
+ * std::ifstream. Pages are advised for sequential access. Mapping is supported on POSIX platforms;
+ * elsewhere Open() fails and callers are expected to fall back to std::ifstream.
+ *
+ */
+class MappedInputFile
+{
+    
+public:
+    
+    // Constructor
+    MappedInputFile();
+    
+    // Destructor, unmaps the file
+    ~MappedInputFile();
+    
+    // Maps iFileName. Returns false if the file cannot be opened or mapped (including empty files)
+    bool Open(const std::string& iFileName);
+    
+    // Unmaps the file. Data returned by GetData() must not be used afterwards.
+    void Close();
+    
+    // Mapped file contents and size in bytes, nullptr and 0 when not open
+    const char* GetData() const;
+    size_t GetSize() const;
+    
+private:
+    
+    // Not copyable
+    MappedInputFile(const MappedInputFile&);
+    MappedInputFile& operator=(const MappedInputFile&);
+    
+    // Start and size of the mapping
+    const char*             data_;
+    size_t                  size_;
+};
+
+#endif /* MAPPEDINPUTFILE_H_ */
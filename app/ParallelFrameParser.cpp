@@ -0,0 +1,216 @@
+/* Copyright (c) 2020 Xperi Corporation (and its subsidiaries). All rights reserved.
+ 
+Permission is hereby granted, free of charge, to any person obtaining
+a copy of this software and associated documentation files (the "Software"),
+to deal in the Software without restriction, including without limitation
+the rights to use, copy, modify, merge, publish, distribute, sublicense,
+and/or sell copies of the Software, and to permit persons to whom the
+Software is furnished to do so, subject to the following conditions:
+ 
+The above copyright notice and this permission notice shall be included
+in all copies or substantial portions of the Software.
+ 
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ 
+IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT
+OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR
+THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include "ParallelFrameParser.h"
+
+// Frames parsed ahead of the last one taken, per worker thread
+static const uint32_t kFramesAheadPerThread = 4;
+
+// Constructor
+ParallelFrameParser::ParallelFrameParser()
+{
+    bitstream_ = nullptr;
+    frames_ = nullptr;
+    frameCount_ = 0;
+    lazyAudioData_ = false;
+    nextFrameToParse_ = 0;
+    nextFrameToTake_ = 0;
+    stopped_ = false;
+}
+
+// Destructor
+ParallelFrameParser::~ParallelFrameParser()
+{
+    Stop();
+}
+
+// ParallelFrameParser::Start() implementation
+void ParallelFrameParser::Start(const char* iBitstream, const std::vector<IABFrameIndexEntry>& iFrames, uint32_t iNumThreads, bool iLazyAudioData)
+{
+    Stop();
+    
+    bitstream_ = iBitstream;
+    frames_ = iFrames.empty() ? nullptr : &iFrames[0];
+    frameCount_ = static_cast<uint32_t>(iFrames.size());
+    lazyAudioData_ = iLazyAudioData;
+    nextFrameToParse_ = 0;
+    nextFrameToTake_ = 0;
+    stopped_ = false;
+    
+    if (0 == iNumThreads)
+    {
+        iNumThreads = 1;
+    }
+    
+    FrameSlot emptySlot = { nullptr, false };
+    window_.assign(iNumThreads * kFramesAheadPerThread, emptySlot);
+    
+    for (uint32_t i = 0; i < iNumThreads; i++)
+    {
+        workers_.push_back(std::thread(&ParallelFrameParser::ParseFrames, this));
+    }
+}
+
+// ParallelFrameParser::TakeNextFrame() implementation
+bool ParallelFrameParser::TakeNextFrame(IABFrameInterface*& oFrame)
+{
+    oFrame = nullptr;
+    
+    std::unique_lock<std::mutex> lock(mutex_);
+    
+    if (stopped_ || (nextFrameToTake_ >= frameCount_))
+    {
+        return false;
+    }
+    
+    FrameSlot& slot = window_[nextFrameToTake_ % window_.size()];
+    
+    while (!slot.parsed_)
+    {
+        frameCondition_.wait(lock);
+    }
+    
+    if (nullptr == slot.frame_)
+    {
+        // Left to serial parsing, no need to parse further
+        stopped_ = true;
+        windowCondition_.notify_all();
+        return false;
+    }
+    
+    oFrame = slot.frame_;
+    slot.frame_ = nullptr;
+    slot.parsed_ = false;
+    nextFrameToTake_++;
+    
+    // A slot is free for the next frame
+    windowCondition_.notify_all();
+    
+    return true;
+}
+
+// ParallelFrameParser::GetBitstreamOffset() implementation
+uint64_t ParallelFrameParser::GetBitstreamOffset() const
+{
+    if (0 == nextFrameToTake_)
+    {
+        return 0;
+    }
+    
+    const IABFrameIndexEntry& lastFrame = frames_[nextFrameToTake_ - 1];
+    
+    return lastFrame.frameOffset_ + lastFrame.frameSize_;
+}
+
+// ParallelFrameParser::Stop() implementation
+void ParallelFrameParser::Stop()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stopped_ = true;
+    }
+    
+    windowCondition_.notify_all();
+    
+    for (std::vector<std::thread>::iterator iter = workers_.begin(); iter != workers_.end(); iter++)
+    {
+        iter->join();
+    }
+    
+    workers_.clear();
+    
+    for (std::vector<FrameSlot>::iterator iter = window_.begin(); iter != window_.end(); iter++)
+    {
+        if (iter->frame_)
+        {
+            IABFrameInterface::Delete(iter->frame_);
+        }
+    }
+    
+    window_.clear();
+}
+
+// ParallelFrameParser::ParseFrames() implementation
+void ParallelFrameParser::ParseFrames()
+{
+    // Frames are released to the validating thread, and deleted there, all elements at once.
+    // Preamble payloads are not validated.
+    IABParserInterface* parser = IABParserInterface::Create(kIABFrameAllocator_Arena);
+    parser->SetLazyAudioDataParsing(lazyAudioData_);
+    parser->SetPreamblePayloadParsing(kIABPreamblePayload_Skip);
+    
+    std::unique_lock<std::mutex> lock(mutex_);
+    
+    while (true)
+    {
+        // Wait for a frame to parse within the window
+        while (!stopped_ && (nextFrameToParse_ < frameCount_) && (nextFrameToParse_ - nextFrameToTake_ >= window_.size()))
+        {
+            windowCondition_.wait(lock);
+        }
+        
+        if (stopped_ || (nextFrameToParse_ >= frameCount_))
+        {
+            break;
+        }
+        
+        uint32_t frameNumber = nextFrameToParse_++;
+        lock.unlock();
+        
+        // The bitstream is parsed in place, and read only
+        const IABFrameIndexEntry& entry = frames_[frameNumber];
+        IABFrameInterface* frame = nullptr;
+        
+        iabError returnCode = kIABMemoryError;
+        
+        if (nullptr != parser)
+        {
+            returnCode = parser->ParseIABFrame(const_cast<char*>(bitstream_ + entry.frameOffset_), entry.frameSize_);
+            parser->GetIABFrameReleased(frame);
+        }
+        
+        if ((kIABNoError != returnCode) || (parser->GetParsedFrameSize() != entry.frameSize_))
+        {
+            if (frame)
+            {
+                IABFrameInterface::Delete(frame);
+                frame = nullptr;
+            }
+        }
+        
+        lock.lock();
+        
+        FrameSlot& slot = window_[frameNumber % window_.size()];
+        slot.frame_ = frame;
+        slot.parsed_ = true;
+        
+        frameCondition_.notify_one();
+    }
+    
+    lock.unlock();
+    
+    if (parser)
+    {
+        IABParserInterface::Delete(parser);
+    }
+}
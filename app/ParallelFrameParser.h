@@ -0,0 +1,125 @@
+/* Copyright (c) 2020 Xperi Corporation (and its subsidiaries). All rights reserved.
+ 
+Permission is hereby granted, free of charge, to any person obtaining
+a copy of this software and associated documentation files (the "Software"),
+to deal in the Software without restriction, including without limitation
+the rights to use, copy, modify, merge, publish, distribute, sublicense,
+and/or sell copies of the Software, and to permit persons to whom the
+Software is furnished to do so, subject to the following conditions:
+ 
+The above copyright notice and this permission notice shall be included
+in all copies or substantial portions of the Software.
+ 
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ 
+IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT
+OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR
+THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+
+#ifndef PARALLELFRAMEPARSER_H_
+#define PARALLELFRAMEPARSER_H_
+
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "IABElementsAPI.h"
+#include "IABParserAPI.h"
+
+#ifdef USE_MDA_NULLPTR
+/* support lack of nullptr on older C++ compilers such as g++-4.4.7 */
+#include "nullptrOldCompilers.h"
+#endif
+
+using namespace SMPTE::ImmersiveAudioBitstream;
+
+/**
+ *
+ * Parses the frames of an in-memory single-file IA bitstream on a pool of worker threads.
+ *
+ * Frame boundaries come from an IABFrameIndexInterface. Each worker has its own IABParser and
+ * parses whole frames in place from the bitstream, independently of the others. Parsed frames are
+ * handed out by TakeNextFrame() in bitstream order. At most a window of frames ahead of the last
+ * one taken is parsed, to bound memory use.
+ *
+ * A frame that does not parse without error, or that parses to a size other than its index entry,
+ * is not handed out: TakeNextFrame() stops there, and the caller is expected to carry on with a
+ * serial IABParser from GetBitstreamOffset(), so that the frame is parsed, and any error reported,
+ * exactly as without parallel parsing.
+ *
+ */
+class ParallelFrameParser
+{
+    
+public:
+    
+    // Constructor
+    ParallelFrameParser();
+    
+    // Destructor, stops worker threads
+    ~ParallelFrameParser();
+    
+    // Starts iNumThreads workers parsing iFrames from iBitstream, which must stay valid until Stop().
+    // iLazyAudioData enables lazy audio data parsing on the workers' parsers.
+    void Start(const char* iBitstream, const std::vector<IABFrameIndexEntry>& iFrames, uint32_t iNumThreads, bool iLazyAudioData);
+    
+    // Waits for the next frame in bitstream order and takes it over; caller deletes it after use.
+    // Returns false when all frames have been taken, or the next frame is left to serial parsing.
+    bool TakeNextFrame(IABFrameInterface*& oFrame);
+    
+    // Offset in the bitstream following the last frame taken
+    uint64_t GetBitstreamOffset() const;
+    
+    // Stops and joins worker threads, deleting frames not taken
+    void Stop();
+    
+private:
+    
+    // Not copyable
+    ParallelFrameParser(const ParallelFrameParser&);
+    ParallelFrameParser& operator=(const ParallelFrameParser&);
+    
+    // Worker thread body
+    void ParseFrames();
+    
+    // A frame in the window: parsed_ once a worker is done with it, frame_ nullptr if it is
+    // left to serial parsing
+    struct FrameSlot
+    {
+        IABFrameInterface*  frame_;
+        bool                parsed_;
+    };
+    
+    // Bitstream and frame table, see Start()
+    const char*                         bitstream_;
+    const IABFrameIndexEntry*           frames_;
+    uint32_t                            frameCount_;
+    bool                                lazyAudioData_;
+    
+    // Parsed frames, slot of frame N at N % window size
+    std::vector<FrameSlot>              window_;
+    
+    // Next frame for a worker to parse, and next frame to be taken
+    uint32_t                            nextFrameToParse_;
+    uint32_t                            nextFrameToTake_;
+    
+    // A frame was left to serial parsing, or Stop() was called
+    bool                                stopped_;
+    
+    // Guards all the above once workers are started
+    std::mutex                          mutex_;
+    
+    // Signals workers that the window moved or Stop(), and TakeNextFrame() that a frame is parsed
+    std::condition_variable             windowCondition_;
+    std::condition_variable             frameCondition_;
+    
+    std::vector<std::thread>            workers_;
+};
+
+#endif /* PARALLELFRAMEPARSER_H_ */
@@ -20,12 +20,15 @@ OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR
 THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 */
 
+#include <algorithm>
 #include <iomanip>
 #include <fstream>
 #include <iostream>
 #include <sstream>
 
 #include "ValidateIABStream.h"
+#include "FramePipeline.h"
+#include "ParallelFrameParser.h"
 #include "libjson.h"
 
 #ifdef _LOG
@@ -55,6 +58,9 @@ ValidateIABStream::ValidateIABStream()
 	inputFrameCount_ = 0;
     numIssuesToReport_ = 0;
     reportAllIssues_ = true;
+    numParseThreads_ = 1;
+    lazyAudioData_ = false;
+    quickScan_ = false;
     jsonTree_ = json_new(JSON_NODE);
     validationResultSummaryInJson_ = nullptr;
     validationIssuesSummaryInJson_ = nullptr;
@@ -118,6 +124,9 @@ bool ValidateIABStream::AreSettingsValid(ValidationSettings& iSettings)
     validationConstraintSets_ = iSettings.validationConstraintSets_;
     reportAllIssues_ = iSettings.reportAllIssues_;
     numIssuesToReport_ = iSettings.numIssuesToReport_;
+    numParseThreads_ = iSettings.numParseThreads_;
+    lazyAudioData_ = iSettings.lazyAudioData_;
+    quickScan_ = iSettings.quickScan_;
 
     return true;
 }
@@ -127,6 +136,8 @@ iabError ValidateIABStream::OpenInputFile(std::string iInputFileName)
 {
     inputFile_ = new std::ifstream(iInputFileName.c_str(), std::ifstream::in | std::ifstream::binary);
     
+    inputStream_ = inputFile_;
+    
     if (!inputFile_->good())
     {
         return kIABGeneralError;
@@ -135,6 +146,20 @@ iabError ValidateIABStream::OpenInputFile(std::string iInputFileName)
     return kIABNoError;
 }
 
+// ValidateIABStream::OpenMappedInputFile() implementation
+iabError ValidateIABStream::OpenMappedInputFile(std::string iInputFileName)
+{
+    if (!mappedInputFile_.Open(iInputFileName))
+    {
+        return OpenInputFile(iInputFileName);
+    }
+    
+    // The parser reads the mapping in place, end of input is reported by the parser
+    inputStream_ = nullptr;
+    
+    return kIABNoError;
+}
+
 // ValidateIABStream::CloseInputOutputFiles() implementation
 iabError ValidateIABStream::CloseInputOutputFiles()
 {
@@ -146,6 +171,9 @@ iabError ValidateIABStream::CloseInputOutputFiles()
         inputFile_ = nullptr;
     }
     
+    mappedInputFile_.Close();
+    inputStream_ = nullptr;
+    
     return kIABNoError;
 }
 
@@ -198,8 +226,11 @@ ExitStatusCode ValidateIABStream::Validate(ValidationSettings& iSettings)
                 iabParser_ = nullptr;
             }
             
-            // Create an IAB Parser instance to process current file
+            // Create an IAB Parser instance to process current file. Preamble payloads are not validated.
             iabParser_ = IABParserInterface::Create(inputFile_);
+            iabParser_->SetLazyAudioDataParsing(lazyAudioData_);
+            iabParser_->SetFrameHeaderOnlyParsing(quickScan_);
+            iabParser_->SetPreamblePayloadParsing(kIABPreamblePayload_Skip);
             
             // Parse the bitstream into IAB frame
             returnCode = iabParser_->ParseIABFrame();
@@ -227,6 +258,7 @@ ExitStatusCode ValidateIABStream::Validate(ValidationSettings& iSettings)
                 inputFile_->close();
                 delete inputFile_;
                 inputFile_ = nullptr;
+                inputStream_ = nullptr;
             }
             
             const IABFrameInterface *frameInterface = nullptr;
@@ -240,74 +272,27 @@ ExitStatusCode ValidateIABStream::Validate(ValidationSettings& iSettings)
                 break;
             }
             
-            if (inputFrameCount_ > 0)
-            {
-                // Check and update maxRendered if necessary
-                IABMaxRenderedRangeType maxRendered = 0;
-                frameInterface->GetMaxRendered(maxRendered);
-                if (maxRendered > bitstreamMaxRendered_)
-                {
-                    bitstreamMaxRendered_ = maxRendered;
-                }
-            }
-            else
-            {
-                // First frame, record bitstream summary for reporting
-                // Note that these items should be static for a valid bitstream and leave it to the validator to pick up any issues.
-                RecordBitstreamSummary(frameInterface);
-            }
-            
-            // Validate the parsed frame. The validator will keep tracks of validation state, warnings and errors
-            // These will be checked when validation completes or aborted
-            returnCode = iabValidator_->ValidateIABFrame(frameInterface, inputFrameCount_);
-            if (kIABNoError != returnCode)
-            {
-                // Temporary reporting, parser error reporting will be finalised in PACL-669
-                LOG_ERR("The application has encountered an error when validating a parsed IAB frame.\n");
-                LOG_ERR("Error code: " + intToString(returnCode));
-                noProcessingError = false;
-                status_code_ = kIABValidatorIABParsedFrameValidationFailed;
-                break;
-            }
-            
-            inputFrameCount_++;
-            
-            if ((reportAllIssues_ == false) && (DoesNumOfIssuesExceed() == true))
+            if (!ValidateParsedFrame(frameInterface))
             {
-                status_code_ = kIABValidatorIssuesExceeded;
                 noProcessingError = false;
                 break;
             }
-            
-            // Display progress every 50 frames
-            if ((inputFrameCount_ % 50) == 0)
-            {
-                std::cout << "Frames processed: " << inputFrameCount_ << std::endl << std::flush;
-            }
         }
     }
     else    // single-file input
     {
         LOG_OUT("Processing input file : " + inputFileStem_ + inputFileExt_ + ". This could take several minutes for complex or long bitstreams ........\n" );
         
+        // Frames are parsed in a thread of their own, ahead of their validation in this one
+        FramePipeline framePipeline;
+        
         while (1)
         {
-            if (inputFrameCount_ > 0)
-            {
-                if (inputFile_->eof())
-                {
-                    // Finished processing
-                    inputFile_->close();
-                    delete inputFile_;
-                    inputFile_ = nullptr;
-                    break;
-                }
-            }
-            else
+            if (inputFrameCount_ == 0)
             {
                 // First frame, open the input file for the Parser to use
                 std::string inputFile = inputFileStem_ + inputFileExt_;
-                if (kIABNoError != OpenInputFile(inputFile))
+                if (kIABNoError != OpenMappedInputFile(inputFile))
                 {
                     LOG_ERR( "!Error in opening file : " +inputFile + ". Input file name error or missing input file.\n");
                     noProcessingError = false;
@@ -324,17 +309,59 @@ ExitStatusCode ValidateIABStream::Validate(ValidationSettings& iSettings)
                     iabParser_ = nullptr;
                 }
                 
-                // Create an IAB Parser instance to process current file
-                iabParser_ = IABParserInterface::Create(inputFile_);
+                // With more than one parsing thread, frames are first parsed concurrently, see
+                // ValidateIndexedFrames(). Serial parsing carries on from where these end. A quick scan
+                // does not parse enough to gain from more threads.
+                uint64_t bitstreamOffset = 0;
+                
+                if ((numParseThreads_ > 1) && !quickScan_ && (mappedInputFile_.GetData() != nullptr))
+                {
+                    if (!ValidateIndexedFrames(bitstreamOffset))
+                    {
+                        noProcessingError = false;
+                        break;
+                    }
+                    
+                    if (bitstreamOffset >= mappedInputFile_.GetSize())
+                    {
+                        // Finished processing
+                        break;
+                    }
+                }
+                
+                // Create an IAB Parser instance to process current file. Frames are released to this
+                // thread, and deleted after validation, all elements at once. Preamble payloads are
+                // not validated.
+                if (mappedInputFile_.GetData() != nullptr)
+                {
+                    iabParser_ = IABParserInterface::Create(mappedInputFile_.GetData() + bitstreamOffset, mappedInputFile_.GetSize() - bitstreamOffset, kIABFrameAllocator_Arena);
+                }
+                else
+                {
+                    iabParser_ = IABParserInterface::Create(inputStream_, kIABFrameAllocator_Arena);
+                }
+                
+                iabParser_->SetLazyAudioDataParsing(lazyAudioData_);
+                iabParser_->SetFrameHeaderOnlyParsing(quickScan_);
+                iabParser_->SetPreamblePayloadParsing(kIABPreamblePayload_Skip);
+                framePipeline.Start(iabParser_, inputStream_);
             }
             
-            // Parse the bitstream into IAB frame
+            // Take the next frame parsed from the bitstream
+            IABFrameInterface *frameInterface = nullptr;
             
-            returnCode = iabParser_->ParseIABFrame();
-            // TODO Process error code to provide more info
-            
-            if (kIABNoError != returnCode)
+            if (!framePipeline.TakeNextFrame(frameInterface))
             {
+                returnCode = framePipeline.GetParseResult();
+                
+                if (kIABNoError == returnCode)
+                {
+                    // Finished processing
+                    framePipeline.Stop();
+                    CloseInputOutputFiles();
+                    break;
+                }
+                
                 if ((inputFrameCount_ == 0) || (returnCode != kIABParserEndOfStreamReached))
                 {
                     // Temporary reporting, parser error reporting will be finalised in PACL-669
@@ -351,9 +378,7 @@ ExitStatusCode ValidateIABStream::Validate(ValidationSettings& iSettings)
                 break;
             }
             
-            const IABFrameInterface *frameInterface = nullptr;
-            
-            if (kIABNoError != iabParser_->GetIABFrame(frameInterface) || frameInterface == nullptr)
+            if (frameInterface == nullptr)
             {
                 LOG_ERR("The application is unable to get the parsed IAB frame from the parser.\n");
                 noProcessingError = false;
@@ -361,50 +386,18 @@ ExitStatusCode ValidateIABStream::Validate(ValidationSettings& iSettings)
                 break;
             }
             
-            if (inputFrameCount_ > 0)
-            {
-                // Check and update maxRendered if necessary
-                IABMaxRenderedRangeType maxRendered = 0;
-                frameInterface->GetMaxRendered(maxRendered);
-                if (maxRendered > bitstreamMaxRendered_)
-                {
-                    bitstreamMaxRendered_ = maxRendered;
-                }
-            }
-            else
-            {
-                // First frame, record bitstream summary for reporting
-                RecordBitstreamSummary(frameInterface);
-            }
-            
-            // Validate the parsed frame. The validator will keep tracks of validation state, warnings and errors
-            // These will be checked when validation completes or aborted
-            returnCode = iabValidator_->ValidateIABFrame(frameInterface, inputFrameCount_);
-            if (kIABNoError != returnCode)
-            {
-                // Temporary reporting, parser error reporting will be finalised in PACL-669
-                LOG_ERR("The application has encountered an error when validating a parsed IAB frame.\n");
-                LOG_ERR("Error code: " + intToString(returnCode) + "\n");
-                noProcessingError = false;
-                status_code_ = kIABValidatorIABParsedFrameValidationFailed;
-                break;
-            }
-
-            inputFrameCount_++;
+            bool continueValidation = ValidateParsedFrame(frameInterface);
+            IABFrameInterface::Delete(frameInterface);
             
-            if ((reportAllIssues_ == false) && (DoesNumOfIssuesExceed() == true))
+            if (!continueValidation)
             {
-                status_code_ = kIABValidatorIssuesExceeded;
                 noProcessingError = false;
                 break;
             }
-            
-            // Display progress every 50 frames
-            if ((inputFrameCount_ % 50) == 0)
-            {
-                LOG_OUT("Frames processed: " + intToString(inputFrameCount_) + "\n");
-            }
         }
+        
+        // Stops parsing ahead, if validation ended early
+        framePipeline.Stop();
     }
     
     LOG_OUT ( "Total frames processed: " + intToString(inputFrameCount_) + "\n\n");
@@ -419,6 +412,106 @@ ExitStatusCode ValidateIABStream::Validate(ValidationSettings& iSettings)
     }
 }
 
+// ValidateIABStream::ValidateParsedFrame() implementation
+bool ValidateIABStream::ValidateParsedFrame(const IABFrameInterface *iFrameInterface)
+{
+    if (inputFrameCount_ > 0)
+    {
+        // Check and update maxRendered if necessary
+        IABMaxRenderedRangeType maxRendered = 0;
+        iFrameInterface->GetMaxRendered(maxRendered);
+        if (maxRendered > bitstreamMaxRendered_)
+        {
+            bitstreamMaxRendered_ = maxRendered;
+        }
+    }
+    else
+    {
+        // First frame, record bitstream summary for reporting
+        RecordBitstreamSummary(iFrameInterface);
+    }
+    
+    // Validate the parsed frame. The validator will keep tracks of validation state, warnings and errors
+    // These will be checked when validation completes or aborted
+    iabError returnCode = ValidateFrame(iFrameInterface);
+    if (kIABNoError != returnCode)
+    {
+        // Temporary reporting, parser error reporting will be finalised in PACL-669
+        LOG_ERR("The application has encountered an error when validating a parsed IAB frame.\n");
+        LOG_ERR("Error code: " + intToString(returnCode) + "\n");
+        status_code_ = kIABValidatorIABParsedFrameValidationFailed;
+        return false;
+    }
+    
+    inputFrameCount_++;
+    
+    if ((reportAllIssues_ == false) && (DoesNumOfIssuesExceed() == true))
+    {
+        status_code_ = kIABValidatorIssuesExceeded;
+        return false;
+    }
+    
+    // Display progress every 50 frames
+    if ((inputFrameCount_ % 50) == 0)
+    {
+        LOG_OUT("Frames processed: " + intToString(inputFrameCount_) + "\n");
+    }
+    
+    return true;
+}
+
+// ValidateIABStream::ValidateFrame() implementation
+iabError ValidateIABStream::ValidateFrame(const IABFrameInterface *iFrameInterface)
+{
+    if (!quickScan_)
+    {
+        return iabValidator_->ValidateIABFrame(iFrameInterface, inputFrameCount_);
+    }
+    
+    IABElementCountType subElementCount = 0;
+    iFrameInterface->GetSubElementCount(subElementCount);
+    frameSubElementCounts_.push_back(subElementCount);
+    
+    return iabValidator_->ValidateIABFrameHeader(iFrameInterface, inputFrameCount_);
+}
+
+// ValidateIABStream::ValidateIndexedFrames() implementation
+bool ValidateIABStream::ValidateIndexedFrames(uint64_t& oBitstreamOffset)
+{
+    oBitstreamOffset = 0;
+    
+    IABFrameIndexInterface* frameIndex = IABFrameIndexInterface::Create();
+    
+    if (nullptr == frameIndex)
+    {
+        return true;
+    }
+    
+    // Any error found by the index is left to serial parsing, and the frames before it are
+    // all that is parsed concurrently
+    frameIndex->Build(mappedInputFile_.GetData(), mappedInputFile_.GetSize());
+    
+    ParallelFrameParser parallelParser;
+    parallelParser.Start(mappedInputFile_.GetData(), frameIndex->GetFrames(), numParseThreads_, lazyAudioData_);
+    
+    // Frames are validated in bitstream order, as parsed serially
+    bool continueValidation = true;
+    IABFrameInterface *frameInterface = nullptr;
+    
+    while (continueValidation && parallelParser.TakeNextFrame(frameInterface))
+    {
+        continueValidation = ValidateParsedFrame(frameInterface);
+        IABFrameInterface::Delete(frameInterface);
+    }
+    
+    oBitstreamOffset = parallelParser.GetBitstreamOffset();
+    
+    parallelParser.Stop();
+    IABFrameIndexInterface::Delete(frameIndex);
+    
+    return continueValidation;
+}
+
 // ValidateIABStream::RecordBitstreamSummary() implementation
 void ValidateIABStream::RecordBitstreamSummary(const IABFrameInterface *iFrameInterface)
 {
@@ -433,10 +526,23 @@ void ValidateIABStream::RecordBitstreamSummary(const IABFrameInterface *iFrameIn
 void ValidateIABStream::DisplayValidationSummary()
 {
     std::cout << "Bitstream Summary Information:" << std::endl;
+    
+    if (quickScan_)
+    {
+        std::cout << "\tScanMode:                 QuickScan, frame headers only" << std::endl;
+    }
+    
     std::cout << "\tSampleRate:               " <<  GetSampleRateString(bitstreamSampleRate_) << std::endl;
     std::cout << "\tFrameRate:                " << GetFrameRateString(bitstreamFrameRate_) << std::endl;
     std::cout << "\tBitDepth:                 " << GetBitDepthString(bitstreamBitDepth_) << std::endl;
     std::cout << "\tFrameCount:               " << inputFrameCount_ << std::endl;
+    
+    if (quickScan_ && !frameSubElementCounts_.empty())
+    {
+        std::cout << "\tSubElementCount:          " << *std::min_element(frameSubElementCounts_.begin(), frameSubElementCounts_.end())
+            << " to " << *std::max_element(frameSubElementCounts_.begin(), frameSubElementCounts_.end()) << std::endl;
+    }
+    
     std::cout << "\tMaxRenderedInStream:      " << bitstreamMaxRendered_ << std::endl << std::endl;
     
     if (validationResultSummaryInJson_)
@@ -479,6 +585,22 @@ void ValidateIABStream::ReportBitstreamSummary()
         json_push_back(summaryNode, json_new_a("FrameCount", intToString(inputFrameCount_).c_str()));
         json_push_back(summaryNode, json_new_a("MaxRendered", intToString(bitstreamMaxRendered_).c_str()));
     }
+    
+    if (quickScan_)
+    {
+        json_push_back(summaryNode, json_new_a("ScanMode", "QuickScan"));
+        
+        // Sub-element count of each frame scanned, in bitstream order
+        JSONNODE * subElementCountsNode = json_new(JSON_ARRAY);
+        json_set_name(subElementCountsNode, "FrameSubElementCounts");
+        
+        for (std::vector<IABElementCountType>::const_iterator iter = frameSubElementCounts_.begin(); iter != frameSubElementCounts_.end(); iter++)
+        {
+            json_push_back(subElementCountsNode, json_new_i("", *iter));
+        }
+        
+        json_push_back(summaryNode, subElementCountsNode);
+    }
 
     json_push_back(jsonTree_, summaryNode);
 }
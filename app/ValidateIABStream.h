@@ -28,11 +28,13 @@ THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #include <stdint.h>
 #include <stdio.h>
 #include <set>
+#include <vector>
 
 #include "IABElementsAPI.h"
 #include "IABParserAPI.h"
 #include "IABValidatorAPI.h"
 #include "JSONNode.h"
+#include "MappedInputFile.h"
 
 #if (__GNUC__)
 #include <errno.h>
@@ -154,6 +156,9 @@ struct ValidationSettings
         force_write_ = false;
         do_all_ = false;
         output_file_specified_ = false;
+        numParseThreads_ = 1;
+        lazyAudioData_ = false;
+        quickScan_ = false;
     }
     
     std::set<SupportedConstraintsSet> validationConstraintSets_;
@@ -169,6 +174,9 @@ struct ValidationSettings
     bool showUsage_;                        // true to show application usage
     bool showCommandExamples_;              // true to show application command-line examples
     bool do_all_;                           // Validates all constraintsets.
+    uint32_t numParseThreads_;              // number of threads parsing single-file input frames
+    bool lazyAudioData_;                    // true to parse audio data elements by their header fields only
+    bool quickScan_;                        // true to parse and validate frame headers only
 };
 
 class ValidateIABStream
@@ -204,12 +212,29 @@ private:
     // Opens the specified file, creates a stream and assigns pointer to file_
     iabError OpenInputFile(std::string iInputFileName);
     
+    // Maps the specified file into memory and points inputStream_ at it. Falls back
+    // to OpenInputFile() when the file cannot be mapped.
+    iabError OpenMappedInputFile(std::string iInputFileName);
+    
     // Closes input and output files
     iabError CloseInputOutputFiles();
     
     // Record bitstream info for reporting
     void RecordBitstreamSummary(const IABFrameInterface *iFrameInterface);
     
+    // Records bitstream info and validates a parsed frame of single-file input. Returns false
+    // when validation is to stop, with status_code_ set.
+    bool ValidateParsedFrame(const IABFrameInterface *iFrameInterface);
+    
+    // Validates a parsed frame, or only its frame header for a quick scan
+    iabError ValidateFrame(const IABFrameInterface *iFrameInterface);
+    
+    // Parses the frames of the mapped single-file input on numParseThreads_ threads, and validates
+    // them in order, up to the first one that is not parsed without error. oBitstreamOffset is set to
+    // the end of the last frame validated, for serial parsing to carry on from. Returns false when
+    // validation is to stop, see ValidateParsedFrame().
+    bool ValidateIndexedFrames(uint64_t& oBitstreamOffset);
+    
     // Get Issue ID string for reporting
     std::string GetIssueIDString(int32_t issueId);
     
@@ -272,6 +297,12 @@ private:
     // Pointer to the current input file to be processed.
     std::ifstream 			*inputFile_;
     
+    // Single-file input, mapped into memory where supported
+    MappedInputFile         mappedInputFile_;
+    
+    // Stream the parser reads from, either inputFile_ or the mapped input file stream
+    std::istream            *inputStream_;
+    
     // Input frame count to keep track of number of IAB frames processed, also used for progress update
     uint32_t                inputFrameCount_;
     
@@ -279,6 +310,15 @@ private:
     uint32_t                numIssuesToReport_;
     bool                    reportAllIssues_;
     
+    // Number of threads parsing single-file input frames
+    uint32_t                numParseThreads_;
+    
+    // Audio data elements are parsed by their header fields only
+    bool                    lazyAudioData_;
+    
+    // Frame headers only are parsed and validated
+    bool                    quickScan_;
+    
     // ConstraintSets to validate against
     std::set<SupportedConstraintsSet>   validationConstraintSets_;
     
@@ -291,6 +331,9 @@ private:
     IABFrameRateType            bitstreamFrameRate_;
     IABBitDepthType             bitstreamBitDepth_;
     IABMaxRenderedRangeType     bitstreamMaxRendered_;
+    
+    // Sub-element count of each frame, for a quick scan
+    std::vector<IABElementCountType>    frameSubElementCounts_;
   
     // Stores the complete json tree.
     JSONNODE  *jsonTree_;
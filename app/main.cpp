@@ -49,7 +49,7 @@ void DisplayProgramID(void)
 
 static void ShowUsage(void)
 {
-    printf("Usage: iab-validator -i<file path> [-c<N> | -cA] [-r1 | -r2] [-s] [-o<file path>] [-w] [-l<N>] [-h] [-ex]\n\n"
+    printf("Usage: iab-validator -i<file path> [-c<N> | -cA] [-r1 | -r2] [-s] [-j<N>] [-a] [-q] [-o<file path>] [-w] [-l<N>] [-h] [-ex]\n\n"
            " -i<file path>                  Full or relative path to the file for validation \n\n\n"
            
            "Option Summary:\n\n"
@@ -58,6 +58,9 @@ static void ShowUsage(void)
            " -r1,    --report1              Generate summary report file.\n"
            " -r2,    --report2              Generate detailed report file.\n"
            " -s,     --single-file          Specifies single-file input.\n"
+           " -j<N>,  --threads<N>           Parse single-file input frames with N threads.\n"
+           " -a,     --lazy_audio           Parse audio data elements by their header fields only.\n"
+           " -q,     --quick_scan           Parse and validate frame headers only.\n"
            " -o,     --output<file path>    File path of the output JSON report.\n"
            " -w,     --force_write          Overwrite any existing output report file.\n"
            " -l<N>,  --limit<N>             Teminate validation if number of found issues exceed N.\n"
@@ -83,7 +86,20 @@ static void ShowUsage(void)
            "Input File Options:\n\n"
            
            " -s,     --single-file\n"
-           "  Specifies single-file input. When -s or --single-file is not specified, multi-file input is assumed.\n\n\n"
+           "  Specifies single-file input. When -s or --single-file is not specified, multi-file input is assumed.\n\n"
+
+           " -j<N>,  --threads<N>\n"
+           "  Parses frames of a single-file input concurrently on N threads, N from 1 to 64, while frames are\n"
+           "  validated in order. Validation results are the same as with the default of 1 thread.\n\n"
+
+           " -a,     --lazy_audio\n"
+           "  Parses DLC and PCM audio data elements by their header fields only, skipping over coded audio.\n"
+           "  Faster, but issues within coded audio are not reported.\n\n"
+
+           " -q,     --quick_scan\n"
+           "  Parses the frame header of each frame only, skipping the frame sub-elements, for a fast summary of\n"
+           "  the bitstream. Frame count, per-frame sub-element counts and frame header persistence issues are\n"
+           "  reported, other issues are not. -j<N> is ignored.\n\n\n"
 
            "Output Options:\n\n"
            
@@ -371,6 +387,39 @@ bool ExtractCommandlineParams(int argc, char* argv[], ValidationSettings&  oVali
                 return false;
             }
         }
+        // Check and process parsing threads option
+        else if ((std::string(argv[i]).compare(0, 2, "-j") == 0) || (std::string(argv[i]).compare(0, 9, "--threads") == 0))
+        {
+            std::string threadsOptionString = argv[i];
+            size_t numberOffset = (threadsOptionString.compare(0, 2, "-j") == 0) ? 2 : 9;
+            
+            if ((threadsOptionString.size() == numberOffset) ||
+                (threadsOptionString.find_first_not_of("0123456789", numberOffset) != std::string::npos))
+            {
+                std::cerr << "!Error:  Invalid number used with -j or --threads option." << std::endl << std::endl;
+                return false;
+            }
+            
+            int32_t numThreads = atoi(threadsOptionString.c_str() + numberOffset);
+            
+            if ((numThreads < 1) || (numThreads > 64))
+            {
+                std::cerr << "!Error:  Invalid number used with -j or --threads option." << std::endl << std::endl;
+                return false;
+            }
+            
+            oValidationSettings.numParseThreads_ = static_cast<uint32_t>(numThreads);
+        }
+        // Check and process lazy audio data parsing option
+        else if ((std::string(argv[i]) == "-a") || (std::string(argv[i]) == "--lazy_audio"))
+        {
+            oValidationSettings.lazyAudioData_ = true;
+        }
+        // Check and process quick scan option
+        else if ((std::string(argv[i]) == "-q") || (std::string(argv[i]) == "--quick_scan"))
+        {
+            oValidationSettings.quickScan_ = true;
+        }
         // Command line parameter not matching any option
         else
         {
@@ -71,6 +71,8 @@ namespace ImmersiveAudioBitstream
 	 *    ClearSubElements() - Ownership of all sub element instances in current list is released
 	 *    RemoveSubElement() - Ownership of a single specific sub element instance, if found in 
 	 *                         current list, is released
+	 * Both return \link kIABNotImplementedError \endlink for sub elements of frames parsed with
+	 * kIABFrameAllocator_Arena, which are released with their frame, see IABParserInterface::Create().
 	 *
 	 * @class IABFrameInterface
      *
@@ -90,6 +92,22 @@ namespace ImmersiveAudioBitstream
          */
         static IABFrameInterface* Create(std::istream* inputStream);
         
+        /**
+         * Creates an IABFrameInterface instance for parsing a frame in place from a data buffer.
+         *
+         * The frame is parsed directly from iFrameBuffer by DeSerialize(), without copying the data
+         * into a stream. Caller retains ownership of the buffer, which must stay valid until
+         * DeSerialize() returns.
+         *
+         * @memberof IABFrameInterface
+         *
+		 * @param[in] iFrameBuffer points to the beginning of the frame data.
+		 * @param[in] iBufferSize size of the frame data buffer, in bytes.
+		 *
+		 * @returns pointer to IABFrameInterface instance created
+         */
+        static IABFrameInterface* Create(const char* iFrameBuffer, uint32_t iBufferSize);
+        
         /**
          * Deletes an IABFrameInterface instance
 		 *
@@ -277,6 +295,8 @@ namespace ImmersiveAudioBitstream
 		* instances. By clearing the list, the ownship to all of the sub element instance is
 		* returned to caller. Caller is responsible for managing and cleaning out released
 		* IAB element instances.
+		* The list of a frame parsed with kIABFrameAllocator_Arena, or of its sub elements, is left
+		* as is if it holds elements allocated from the frame arena.
 		*
 		* @memberof IABFrameInterface
 		*
@@ -302,6 +322,8 @@ namespace ImmersiveAudioBitstream
 		* instance *iSubElement. Caller takes over the ownership of instance, for
 		* re-purposing for example. Caller must delete the instance outside this call
 		* if it is no longer needed.
+		* An instance allocated from the arena of a frame parsed with kIABFrameAllocator_Arena is
+		* not removed, and kIABNotImplementedError is returned.
 		*
 		* @memberof IABFrameInterface
 		*
@@ -356,9 +378,28 @@ namespace ImmersiveAudioBitstream
          *
          * @param[out] oBuffer buffer to contain the serialized frame
          *
-         * @returns \link kIABNoError \endlink if no errors. Other values indicate an error.
+         * @returns \link kIABNoError \endlink if no errors. Other values indicate an error, and nothing is
+         *          written to oBuffer.
          */
         virtual iabError Serialize(std::ostream &oBuffer) = 0;
+
+        /**
+         * Serializes current frame into a caller-provided memory buffer, eg. a pre-allocated output
+         * packet. The frame is packed directly into oBuffer. Once the frame has been serialized
+         * once, no memory is allocated unless a frame is larger than iBufferSize.
+         *
+         * @memberof IABFrameInterface
+         *
+         * @param[out] oBuffer buffer to contain the serialized frame. May be nullptr if iBufferSize is 0,
+         *             to query the size of the serialized frame.
+         * @param[in] iBufferSize size of oBuffer, in bytes
+         * @param[out] oFrameSize size of the serialized frame, in bytes. When oBuffer is too small, this is
+         *             the buffer size required, and the content of oBuffer is unspecified.
+         *
+         * @returns \link kIABNoError \endlink if no errors. \link kIABPackerBufferTooSmallError \endlink if
+         *          oBuffer is too small. Other values indicate an error.
+         */
+        virtual iabError Serialize(uint8_t* oBuffer, uint32_t iBufferSize, uint32_t &oFrameSize) = 0;
         
         /**
          * De-serializes an IAB frame from input stream.
@@ -569,6 +610,8 @@ namespace ImmersiveAudioBitstream
 	 *    ClearSubElements() - Ownership of all sub element instances in current list is released
 	 *    RemoveSubElement() - Ownership of a single specific sub element instance, if found in
 	 *                         current list, is released
+	 * Both return \link kIABNotImplementedError \endlink for sub elements of frames parsed with
+	 * kIABFrameAllocator_Arena, which are released with their frame, see IABParserInterface::Create().
 	 *
 	 * @class IABBedDefinitionInterface
      */
@@ -780,6 +823,8 @@ namespace ImmersiveAudioBitstream
 		* instances. By clearing the list, the ownship to all of the sub element instance is
 		* returned to caller. Caller is responsible for managing and cleaning out released
 		* IAB element instances.
+		* The list of a frame parsed with kIABFrameAllocator_Arena, or of its sub elements, is left
+		* as is if it holds elements allocated from the frame arena.
 		*
 		* @memberof IABBedDefinitionInterface
 		*
@@ -805,6 +850,8 @@ namespace ImmersiveAudioBitstream
 		* instance *iSubElement. Caller takes over the ownership of instance, for
 		* re-purposing for example. Caller must delete the instance outside this call
 		* if it is no longer needed.
+		* An instance allocated from the arena of a frame parsed with kIABFrameAllocator_Arena is
+		* not removed, and kIABNotImplementedError is returned.
 		*
 		* @memberof IABBedDefinitionInterface
 		*
@@ -1357,6 +1404,8 @@ namespace ImmersiveAudioBitstream
 	 *    ClearSubElements() - Ownership of all sub element instances in current list is released
 	 *    RemoveSubElement() - Ownership of a single specific sub element instance, if found in
 	 *                         current list, is released
+	 * Both return \link kIABNotImplementedError \endlink for sub elements of frames parsed with
+	 * kIABFrameAllocator_Arena, which are released with their frame, see IABParserInterface::Create().
 	 *
 	 * @class IABObjectDefinitionInterface
      */
@@ -1590,6 +1639,8 @@ namespace ImmersiveAudioBitstream
 		* instances. By clearing the list, the ownship to all of the sub element instance is
 		* returned to caller. Caller is responsible for managing and cleaning out released
 		* IAB element instances.
+		* The list of a frame parsed with kIABFrameAllocator_Arena, or of its sub elements, is left
+		* as is if it holds elements allocated from the frame arena.
 		*
 		* @memberof IABObjectDefinitionInterface
 		*
@@ -1615,6 +1666,8 @@ namespace ImmersiveAudioBitstream
 		* instance *iSubElement. Caller takes over the ownership of instance, for
 		* re-purposing for example. Caller must delete the instance outside this call
 		* if it is no longer needed.
+		* An instance allocated from the arena of a frame parsed with kIABFrameAllocator_Arena is
+		* not removed, and kIABNotImplementedError is returned.
 		*
 		* @memberof IABObjectDefinitionInterface
 		*
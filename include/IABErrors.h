@@ -74,6 +74,7 @@ namespace ImmersiveAudioBitstream {
 		kIABPackerObjectSpreadModeError       = 1004,           /**< Packer error: Out-of-range object spread mode value encountered during packing. Fatal. */
 		kIABPackerDLCError                    = 1005,           /**< Packer error: error during DLC encoding. */
 		kIABPackerPCMError                    = 1006,           /**< Packer error: error during PCM packing. */
+		kIABPackerBufferTooSmallError         = 1007,           /**< Packer error: output buffer too small for the packed frame. */
         
         kIABParserGeneralError                = 2000,           /**< IAB parser general error. Fatal. Start of a block of errors used by IAB bitstream parser only. */
 		kIABParserParsingError                = 2001,           /**< Parsing error: General error during parsing. Fatal. */
@@ -106,6 +107,7 @@ namespace ImmersiveAudioBitstream {
         kIABParserInvalidFrameRateError       = 2028,           /**< Parsing error: Found an invalid frame rate. Fatal. */
         kIABParserInvalidBitDepthError        = 2029,           /**< Parsing error: Found an invalid bit depth. Fatal. */
         kIABParserFrameRateNotImplementedError = 2030,          /**< Parsing error: Support for this frame rate is not implmented. Fatal. */
+        kIABParserFrameIndexError             = 2031,           /**< Frame index sidecar is malformed, or does not match the bitstream. */
         
 		kIABRendererGeneralError              = 3000,           /**< IAB renderer general error. Fatal. Start of a block of errors used by IAB bitstream renderer only. */
         kIABRendererNotInitialisedError       = 3001,           /**< IAB renderer error. Fatal. IAB Renderer has not been fully initialised. */
@@ -28,6 +28,7 @@ THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #ifndef __IABPARSERAPI_H__
 #define	__IABPARSERAPI_H__
 
+#include <iostream>
 #include <memory>
 #include <vector>
 
@@ -38,6 +39,31 @@ namespace SMPTE
 {
 namespace ImmersiveAudioBitstream
 {
+	/**
+	* @enum IABFrameAllocatorType
+	*
+	* @brief Memory allocation of the elements of parsed frames, see IABParserInterface::Create().
+	*
+	*/
+	enum IABFrameAllocatorType
+	{
+		kIABFrameAllocator_Heap		= 0x0,				/**< Each element is allocated from the heap, and deleted on its own */
+		kIABFrameAllocator_Arena	= 0x1				/**< Elements are allocated from an arena owned by the parsed frame, and released together with the frame */
+	};
+
+	/**
+	* @enum IABPreamblePayloadParsingType
+	*
+	* @brief Handling of the preamble subframe payload of parsed frames, see IABParserInterface::SetPreamblePayloadParsing().
+	*
+	*/
+	enum IABPreamblePayloadParsingType
+	{
+		kIABPreamblePayload_Copy	= 0x0,				/**< The payload is copied into the parsed frame */
+		kIABPreamblePayload_Borrow	= 0x1,				/**< The payload is left in the bitstream buffer when parsing from memory, and copied on first access */
+		kIABPreamblePayload_Skip	= 0x2				/**< The payload is skipped over, only its length is kept */
+	};
+
     /**
      *
      * Represent an interface for an IAB Parser. Must be defined by implementation.
@@ -60,9 +86,28 @@ namespace ImmersiveAudioBitstream
 		* @memberof IABParserInterface
 		*
 		* @param[in] iInputStream pointer to input bitstream for parsing IAB from.
+		* @param[in] iFrameAllocator allocation of parsed frame elements, see below.
+		* @returns a pointer to IABParserInterface instance created
+		*/
+		static IABParserInterface* Create(std::istream* iInputStream, IABFrameAllocatorType iFrameAllocator = kIABFrameAllocator_Heap);
+
+		/**
+		* Creates an IABParser instance on an in-memory IA bitstream, such as a memory-mapped file.
+		* Note that Caller retains ownership of the buffer pointed to by iInputBuffer, which must
+		* stay valid for as long as frames are parsed from it.
+		*
+		* Like Create(std::istream*), this supports API ParseIABFrame() below, parsing one frame
+		* after the other from the start of the buffer. Frames are parsed in place, without copying
+		* the bitstream into a stream.
+		*
+		* @memberof IABParserInterface
+		*
+		* @param[in] iInputBuffer points to the beginning of the IA bitstream.
+		* @param[in] iInputBufferSize size of the IA bitstream, in bytes.
+		* @param[in] iFrameAllocator allocation of parsed frame elements, see below.
 		* @returns a pointer to IABParserInterface instance created
 		*/
-		static IABParserInterface* Create(std::istream* iInputStream);
+		static IABParserInterface* Create(const char* iInputBuffer, uint64_t iInputBufferSize, IABFrameAllocatorType iFrameAllocator = kIABFrameAllocator_Heap);
 
 		/**
 		* Creates an IABParser instance, without setting up input data stream.
@@ -73,11 +118,20 @@ namespace ImmersiveAudioBitstream
 		* frames where each is contained in its own data buffer/stream/file. A typical
 		* application example is from MXF-unwrapped frames.
 		*
+		* With iFrameAllocator set to kIABFrameAllocator_Arena, for any of the Create() calls, the elements
+		* of each parsed frame are allocated from an arena owned by the frame, instead of one by one from
+		* the heap. They are released all at once when the frame is deleted, or parsed again with frame
+		* recycling, see SetFrameRecycling(). This saves allocations when parsing long streams and keeps
+		* the elements of a frame close together in memory. Parsed elements cannot outlive their frame:
+		* their ownership cannot be taken over with ClearSubElements() or RemoveSubElement() of the
+		* frame, bed definitions and object definitions, which return kIABNotImplementedError.
+		*
 		* @memberof IABParserInterface
 		*
+		* @param[in] iFrameAllocator allocation of parsed frame elements.
 		* @returns a pointer to IABParserInterface instance created
 		*/
-		static IABParserInterface* Create();
+		static IABParserInterface* Create(IABFrameAllocatorType iFrameAllocator = kIABFrameAllocator_Heap);
 
         /**
          * Deletes an IABParser instance
@@ -135,6 +189,9 @@ namespace ImmersiveAudioBitstream
 		* Any extra random bytes data before frame data will result in parsing errors.
 		* Any excessive data after end of 1 frame will be discarded/lost.
 		*
+		* The frame is parsed in place from iIABFrameDataBuffer, without copying it. The buffer
+		* is only borrowed for the duration of the call and may be reused once it returns.
+		*
 		* @memberof IABParserInterface
 		*
 		* @param[in] iIABFrameDataBuffer points to beginning of IAB frame data buffer.
@@ -181,6 +238,97 @@ namespace ImmersiveAudioBitstream
 		*/
 		virtual iabError GetIABFrameReleased(IABFrameInterface*& oIABFrame) = 0;
 
+		/** Enables or disables frame recycling. Disabled by default.
+		*
+		* By default, each ParseIABFrame() call parses into a newly created frame object, with all its
+		* sub-elements, and deletes the previous one. With recycling enabled, the previously parsed frame
+		* is parsed again in place, re-using its sub-element objects instead of deleting and allocating
+		* them again.
+		*
+		* As with the default, the frame, and any sub-element pointers obtained from it, only hold the
+		* last parsed frame: their contents are replaced by the next ParseIABFrame() call. A frame taken
+		* over with GetIABFrameReleased() belongs to the caller and is never recycled; the next
+		* ParseIABFrame() call then parses into a new frame.
+		*
+		* @memberof IABParserInterface
+		*
+		* @param[in] iEnable true to enable frame recycling.
+		*
+		* @return \link iabError \endlink if no errors. Other values indicate an error.
+		*/
+		virtual iabError SetFrameRecycling(bool iEnable) = 0;
+
+		/** Enables or disables lazy parsing of audio data elements. Disabled by default.
+		*
+		* With lazy parsing, ParseIABFrame() only parses the header fields of AudioDataDLC and
+		* AudioDataPCM elements: AudioDataID, DLCSize and DLC sample rate. Their coded audio is skipped
+		* using the element size, and kept undecoded. DLC coded audio is parsed on first access, by
+		* IABAudioDataDLCInterface::DecodeDLCToMonoPCM(), and errors in it are reported by that call
+		* instead of ParseIABFrame().
+		*
+		* For an IABParser created on an in-memory bitstream, ParseIABFrame() keeps pointers to the
+		* audio data in the bitstream buffer instead of copies, so the buffer must stay valid for as
+		* long as parsed frames, including frames taken over with GetIABFrameReleased(), are in use.
+		* Audio data of frames parsed from std::istream, or by ParseIABFrame(char*, uint32_t), is copied.
+		*
+		* @memberof IABParserInterface
+		*
+		* @param[in] iEnable true to enable lazy parsing of audio data elements.
+		*
+		* @return \link iabError \endlink if no errors. Other values indicate an error.
+		*/
+		virtual iabError SetLazyAudioDataParsing(bool iEnable) = 0;
+
+		/** Enables or disables frame header only parsing, for a quick scan of a bitstream. Disabled by default.
+		*
+		* With frame header only parsing, ParseIABFrame() parses the preamble subframe, the IA subframe
+		* header, and the data fields of the IAFrame element: version, sample rate, bit depth, frame rate,
+		* MaxRendered and sub-element count. The frame sub-elements are not parsed, the frame body is
+		* skipped using the IA subframe length. A parsed frame has no sub-elements, while
+		* IABFrameInterface::GetSubElementCount() returns the count found in the bitstream. Such a frame
+		* cannot be serialized, IABFrameInterface::Serialize() returns kIABPackerGeneralError.
+		*
+		* Errors within the frame body are not found. A frame is only checked to be complete in the
+		* bitstream, kIABParserIABFrameError is returned for a frame cut short.
+		*
+		* @memberof IABParserInterface
+		*
+		* @param[in] iEnable true to enable frame header only parsing.
+		*
+		* @return \link iabError \endlink if no errors. Other values indicate an error.
+		*/
+		virtual iabError SetFrameHeaderOnlyParsing(bool iEnable) = 0;
+
+		/** Sets how the preamble subframe payload of parsed frames is handled. kIABPreamblePayload_Copy by default.
+		*
+		* With kIABPreamblePayload_Borrow, for an IABParser created on an in-memory bitstream, ParseIABFrame()
+		* keeps a pointer to the preamble payload in the bitstream buffer, which is copied into the frame
+		* only when the payload is requested. The buffer must then stay valid for as long as parsed frames,
+		* including frames taken over with GetIABFrameReleased(), are in use. The payload of frames parsed
+		* from std::istream, or by ParseIABFrame(char*, uint32_t), is copied.
+		*
+		* With kIABPreamblePayload_Skip, the payload is skipped over without being read. Parsed frames keep
+		* the payload length only, and cannot be serialized.
+		*
+		* @memberof IABParserInterface
+		*
+		* @param[in] iPayloadParsing preamble payload handling.
+		*
+		* @return \link iabError \endlink if no errors. Other values indicate an error.
+		*/
+		virtual iabError SetPreamblePayloadParsing(IABPreamblePayloadParsingType iPayloadParsing) = 0;
+
+		/** Gets the number of bitstream bytes taken up by the last frame parsed from memory, that is
+		* parsed by ParseIABFrame() with an IABParser created on an in-memory bitstream, or by
+		* ParseIABFrame(char*, uint32_t). The next frame of an in-memory bitstream starts that many bytes
+		* after the last one. 0 for frames parsed from std::istream.
+		*
+		* @memberof IABParserInterface
+		*
+		* @return number of bytes parsed
+		*/
+		virtual uint64_t GetParsedFrameSize() const = 0;
+
 		/** Gets audio sample rate of IA bitstream
          *
          * @memberof IABParserInterface
@@ -229,6 +377,42 @@ namespace ImmersiveAudioBitstream
          */
         virtual IABMaxRenderedRangeType GetMaximumAssetsToBeRendered() = 0;
         
+		/** Gets the AudioDataIDs of the audio assets, the AudioDataDLC and AudioDataPCM elements, of
+		* the parsed frame, in frame order. This is the order in which DecodeAllAudioAssets() decodes them.
+		*
+		* @memberof IABParserInterface
+		*
+		* @param[out] oAudioDataIDs AudioDataIDs of the audio assets
+		* @returns \link kIABNoError \endlink if no errors. Other values indicate an error.
+		*/
+		virtual iabError GetAudioDataIDs(std::vector<IABAudioDataIDType>& oAudioDataIDs) = 0;
+
+		/** Decodes the audio asset with iAudioDataID in the parsed frame to mono PCM samples.
+		* AudioDataDLC is decoded at its DLC sample rate. Audio assets are looked up by an index of the
+		* frame built during parsing, which follows AudioDataIDs set on the frame's elements afterwards.
+		*
+		* @memberof IABParserInterface
+		*
+		* @param[in] iAudioDataID AudioDataID of the audio asset
+		* @param[out] oAudioSamples buffer for iNumSamples samples
+		* @param[in] iNumSamples number of samples to decode, at most the number of samples in the asset
+		* @returns \link kIABNoError \endlink if no errors. kIABNoSuchParameterError if the frame has
+		* no asset with iAudioDataID. Other values indicate an error.
+		*/
+		virtual iabError DecodeAudioAsset(IABAudioDataIDType iAudioDataID, int32_t* oAudioSamples, uint32_t iNumSamples) = 0;
+
+		/** Decodes all audio assets of the parsed frame to mono PCM samples, in one call.
+		* oAudioSamples[i] receives the asset with the i-th AudioDataID returned by GetAudioDataIDs().
+		*
+		* @memberof IABParserInterface
+		*
+		* @param[out] oAudioSamples iNumAssets caller channel buffers, of iNumSamples samples each
+		* @param[in] iNumAssets number of audio assets in the frame
+		* @param[in] iNumSamples number of samples to decode per asset
+		* @returns \link kIABNoError \endlink if no errors. Other values indicate an error.
+		*/
+		virtual iabError DecodeAllAudioAssets(int32_t* const* oAudioSamples, uint32_t iNumAssets, uint32_t iNumSamples) = 0;
+
         /** Gets a string for the specified IAB error code.
          *
          * @memberof IABParserInterface
@@ -241,6 +425,167 @@ namespace ImmersiveAudioBitstream
         virtual const std::string& getStringForErrorCode(commonErrorCodes iErrorCode) = 0;
 
     };
+
+	/**
+	* @brief Location of a frame in a single-file IA bitstream, see IABFrameIndexInterface.
+	*
+	*/
+	struct IABFrameIndexEntry
+	{
+		uint64_t frameOffset_;			/**< Offset of the frame from the start of the bitstream, in bytes */
+		uint32_t frameSize_;			/**< Size of the frame, preamble and IA subframes included, in bytes */
+	};
+
+    /**
+     *
+     * Represent an interface for an index of the frames of a single-file IA bitstream.
+     *
+     * Frames follow each other in a single-file bitstream, each made of a preamble subframe and an
+     * IA subframe, both with a tag and a 32-bit length. Build() walks these tags and lengths only,
+     * skipping subframe payloads without parsing any element, and records the offset and size
+     * of each frame. A frame can then be parsed on its own, eg. from a memory-mapped file with
+     * IABParserInterface::ParseIABFrame(char*, uint32_t), for random access or parallel parsing.
+     *
+     * The index can be saved to a sidecar file with Write(), and loaded back with Read() instead
+     * of being built again.
+     *
+     * @class IABFrameIndexInterface
+     */
+
+    class IABFrameIndexInterface
+    {
+    public:
+
+		/**
+		* Creates an empty IABFrameIndex instance.
+		*
+		* @memberof IABFrameIndexInterface
+		*
+		* @returns a pointer to IABFrameIndexInterface instance created
+		*/
+		static IABFrameIndexInterface* Create();
+
+        /**
+         * Deletes an IABFrameIndex instance
+         *
+         * @memberof IABFrameIndexInterface
+         *
+         * @param[in] iInstance pointer to the instance of the IABFrameIndexInterface
+         */
+        static void Delete(IABFrameIndexInterface* iInstance);
+
+		/// Destructor
+        virtual ~IABFrameIndexInterface() {}
+
+		/**
+		* Builds the index of an in-memory IA bitstream, such as a memory-mapped file, replacing any
+		* previous index.
+		*
+		* When the bitstream does not end on a frame boundary, or a subframe tag is not the one expected,
+		* the index holds the frames before that point, and the error the parser would report on that
+		* frame is returned: kIABParserEndOfStreamReached for a truncated frame, kIABParserMissingPreambleError
+		* or kIABParserIASubFrameHeaderError otherwise.
+		*
+		* @memberof IABFrameIndexInterface
+		*
+		* @param[in] iInputBuffer points to the beginning of the IA bitstream.
+		* @param[in] iInputBufferSize size of the IA bitstream, in bytes.
+		*
+		* @return \link iabError \endlink if no errors. Other values indicate an error.
+		*/
+		virtual iabError Build(const char* iInputBuffer, uint64_t iInputBufferSize) = 0;
+
+		/**
+		* Builds the index of an IA bitstream read from iInputStream, replacing any previous index.
+		* Only subframe tags and lengths are read, subframe payloads are skipped by seeking over them,
+		* so iInputStream must be seekable. Frame offsets are from the stream position at the start of
+		* the call, where the stream is left positioned on return.
+		*
+		* Errors are reported as for Build(const char*, uint64_t).
+		*
+		* @memberof IABFrameIndexInterface
+		*
+		* @param[in] iInputStream IA bitstream to index.
+		*
+		* @return \link iabError \endlink if no errors. Other values indicate an error.
+		*/
+		virtual iabError Build(std::istream* iInputStream) = 0;
+
+		/**
+		* Gets number of frames in the index.
+		*
+		* @memberof IABFrameIndexInterface
+		*/
+		virtual uint32_t GetFrameCount() const = 0;
+
+		/**
+		* Gets offset and size of a frame.
+		*
+		* @memberof IABFrameIndexInterface
+		*
+		* @param[in] iFrameNumber frame number, from 0 for the first frame of the bitstream.
+		* @param[out] oFrame offset and size of the frame.
+		*
+		* @return \link iabError \endlink if no errors. Other values indicate an error.
+		*/
+		virtual iabError GetFrame(uint32_t iFrameNumber, IABFrameIndexEntry& oFrame) const = 0;
+
+		/**
+		* Gets the frame table, in bitstream order.
+		*
+		* @memberof IABFrameIndexInterface
+		*/
+		virtual const std::vector<IABFrameIndexEntry>& GetFrames() const = 0;
+
+		/**
+		* Gets size of the indexed bitstream, in bytes, as given to, or found by, Build().
+		*
+		* @memberof IABFrameIndexInterface
+		*/
+		virtual uint64_t GetBitstreamSize() const = 0;
+
+		/**
+		* Writes the index to a sidecar, in a compact binary format.
+		*
+		* @memberof IABFrameIndexInterface
+		*
+		* @param[in] oSidecar stream to write the index to, typically a file opened in binary mode.
+		*
+		* @return \link iabError \endlink if no errors. Other values indicate an error.
+		*/
+		virtual iabError Write(std::ostream& oSidecar) const = 0;
+
+		/**
+		* Reads the index of an in-memory IA bitstream from a sidecar written by Write(), replacing
+		* any previous index. The index is checked to be consistent, and to be for a bitstream of the
+		* same size and fingerprint, so that a stale sidecar is rejected with kIABParserFrameIndexError.
+		* The fingerprint is a hash of the first and last 4KB of the bitstream: a change elsewhere
+		* in a bitstream of the same size is not detected.
+		*
+		* @memberof IABFrameIndexInterface
+		*
+		* @param[in] iSidecar stream to read the index from.
+		* @param[in] iInputBuffer points to the beginning of the indexed IA bitstream.
+		* @param[in] iInputBufferSize size of the indexed IA bitstream, in bytes.
+		*
+		* @return \link iabError \endlink if no errors. Other values indicate an error.
+		*/
+		virtual iabError Read(std::istream& iSidecar, const char* iInputBuffer, uint64_t iInputBufferSize) = 0;
+
+		/**
+		* Reads the index of an IA bitstream read from iInputStream from a sidecar written by Write(),
+		* checked as by Read(std::istream&, const char*, uint64_t). The bitstream starts at the stream
+		* position at the start of the call, where the stream is left positioned on return.
+		*
+		* @memberof IABFrameIndexInterface
+		*
+		* @param[in] iSidecar stream to read the index from.
+		* @param[in] iInputStream indexed IA bitstream, seekable.
+		*
+		* @return \link iabError \endlink if no errors. Other values indicate an error.
+		*/
+		virtual iabError Read(std::istream& iSidecar, std::istream* iInputStream) = 0;
+    };
     
 } // namespace ImmersiveAudioBitstream
 } // namespace SMPTE
@@ -81,6 +81,23 @@ namespace ImmersiveAudioBitstream
          */
         virtual iabError ValidateIABFrame(const IABFrameInterface *iIABFrame, uint32_t iFrameIndex) = 0;
         
+        /**
+         *
+         * Validate the frame header of an IAB frame only, for a quick scan of a bitstream. Checks that
+         * bitstream version, sample rate, bit depth and frame rate persist from frame to frame. Frame
+         * sub-elements are not looked at, the frame may be parsed with
+         * IABParserInterface::SetFrameHeaderOnlyParsing().
+         *
+         * Not to be mixed with ValidateIABFrame() on the frames of the same bitstream.
+         *
+         * @memberof IABValidatorInterface
+         *
+         * @param[in] iIABFrame pointer to the IAFrame to be validated
+         * @param[in] iFrameIndex index of the frame being validated.
+         * @return \link kIABNoError \endlink if no errors. Other values indicate an error.
+         */
+        virtual iabError ValidateIABFrameHeader(const IABFrameInterface *iIABFrame, uint32_t iFrameIndex) = 0;
+        
         /** Gets the validation result for constraint set iConstraintSet.
          *
          * @memberof IABValidatorInterface
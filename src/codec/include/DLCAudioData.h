@@ -274,6 +274,8 @@ namespace dlc
 	/**
 	* Represents a sub block consisting of IAB Rice/Golomb residuals
 	* The size of the subblock (in samples) is immutable.
+	* Residuals are stored as signed values, as in PCMResidualsSubBlock. Their Rice/Golomb form is
+	* only produced on request, see getRiceResidual().
 	*/
 	class RiceResidualsSubBlock : public ResidualSubBlock
     {
@@ -311,19 +313,46 @@ namespace dlc
 		*
 		* @return Pointer to an array of residual values of size getSize().
 		*/
-		RiceResidual* getResiduals();
+		int32_t * getResiduals();
 
 		/**
 		* Retrieves a read-only array of residuals associated with the sub block.
 		*
 		* @return Pointer to a constant array of residual values of size getSize().
 		*/
-		const RiceResidual * getResiduals() const;
+		const int32_t * getResiduals() const;
+
+		/**
+		* Retrieves a residual in Rice/Golomb form, split from its value with the current IAB RiceRemBits.
+		*
+		* @param[in] iIndex Index of the residual.
+		* @return Quotient, remainder and sign of the residual.
+		* @throws std::out_of_range if index is not smaller than getSize()
+		*/
+		RiceResidual getRiceResidual(uint32_t iIndex) const;
+
+		/**
+		* Sets a residual from its Rice/Golomb form, combined with the current IAB RiceRemBits.
+		*
+		* @param[in] iIndex Index of the residual.
+		* @param[in] iResidual Quotient, remainder and sign of the residual.
+		* @throws std::out_of_range if index is not smaller than getSize()
+		*/
+		void setRiceResidual(uint32_t iIndex, const RiceResidual &iResidual);
 
 	private:
 
+		friend class AudioData;
+
+		/**
+		* Re-initializes the sub block as constructed with size iSize, keeping its storage, see AudioData.
+		*
+		* @throws std::out_of_range if size is zero
+		*/
+		void reset(uint32_t iSize);
+
 		uint5_t riceRemBits_;
-		std::vector<RiceResidual> residuals_;
+		std::vector<int32_t> residuals_;
 	};
 
 	/**
@@ -376,6 +405,15 @@ namespace dlc
 
 	private:
 
+		friend class AudioData;
+
+		/**
+		* Re-initializes the sub block as constructed with size iSize, keeping its storage, see AudioData.
+		*
+		* @throws std::out_of_range if size is zero
+		*/
+		void reset(uint32_t iSize);
+
 		uint5_t bitDepth_;
 		std::vector<int32_t> residuals_;
 	};
@@ -385,6 +423,12 @@ namespace dlc
 	* Serialization to an actual IAB AudioDataDLC element (or other representation) is not included.
 	* This implementation supports all variations of IAB AudioDataDLC element permitted in ST 2098-2, 
 	* and subclasses tailored to specific use cases can be defined.
+	*
+	* Sub blocks are pooled: once created, the Rice and PCM sub blocks of each index are kept, and
+	* re-initialized in place when the index is initialized again with the same code type. Their residual
+	* storage only grows, so an AudioData that is re-used frame after frame stops allocating once it
+	* has seen the largest sub blocks. Pointers returned by getDLCSubBlock48() and getDLCSubBlock96()
+	* are valid until the sub block is initialized again.
 	*/
 	class AudioData
     {
@@ -622,12 +666,27 @@ namespace dlc
 
 		private:
 
+		// Sub block of an index, NULL until initDLCSubBlock48() or initDLCSubBlock96(), and the sub blocks
+		// of both code types created for the index. These are owned by the AudioData.
+		struct SubBlockSlot
+		{
+			ResidualSubBlock* current_;
+			RiceResidualsSubBlock* rice_;
+			PCMResidualsSubBlock* pcm_;
+		};
+
+		// Makes the sub block of iCodeType in ioSlot current, created or re-initialized with iResidualCount residuals
+		static void initSubBlockSlot(SubBlockSlot &ioSlot, CodeType iCodeType, uint32_t iResidualCount);
+
 		int32_t	shiftBits_;
 		SampleRate	sampleRate_;
 		std::vector<PredRegion> predRegions48_;
 		std::vector<PredRegion> predRegions96_;
-		std::vector<ResidualSubBlock*> subBlocks48_;
-		std::vector<ResidualSubBlock*> subBlocks96_;
+
+		// Slots only grow, slots from numDLCSubBlocks_ on are kept with their sub blocks for re-use
+		uint8_t numDLCSubBlocks_;
+		std::vector<SubBlockSlot> subBlocks48_;
+		std::vector<SubBlockSlot> subBlocks96_;
 	};
 
 } // namespace dlc
@@ -30,6 +30,10 @@ namespace dlc
 
     /**
     * Implements the DLC decoder specified in ST 2098-2.
+    *
+    * The decoder keeps a small cache of direct form predictor coefficients, indexed by the order and lattice
+    * coefficients of a prediction region, since the same regions recur across frames and assets. An instance
+    * must therefore not be used by several threads at the same time.
     */
     class FullDecoder : public Decoder
     {
@@ -41,6 +45,16 @@ namespace dlc
             StatusCode_FATAL_ERROR /**< Unrecoverable error occurred. */
         };
 
+        enum InstructionSet
+        {
+            InstructionSet_Auto, /**< Fastest instruction set supported by the build and the CPU. */
+            InstructionSet_Scalar,
+            InstructionSet_SSE41,
+            InstructionSet_AVX2
+        };
+
+        FullDecoder();
+
         /**
         * @throws std::invalid_argument if sampleRateCode is not supported
         *                               if sampleCount is not supported
@@ -60,6 +74,57 @@ namespace dlc
 			, uint32_t iSampleCount
 			, SampleRate iSampleRateCode
 			, const AudioData& iDLCData);
+
+        /**
+        * Retrieves the number of prediction regions whose direct form coefficients were found in the
+        * coefficient cache, since construction or the last call to resetCoeffCacheCounters().
+        *
+        * @return Number of cache hits.
+        */
+        uint64_t getCoeffCacheHits() const;
+
+        /**
+        * Retrieves the number of prediction regions whose direct form coefficients were converted from
+        * lattice coefficients, since construction or the last call to resetCoeffCacheCounters().
+        *
+        * @return Number of cache misses.
+        */
+        uint64_t getCoeffCacheMisses() const;
+
+        /**
+        * Resets the coefficient cache hit and miss counters. Cached coefficients are kept.
+        */
+        void resetCoeffCacheCounters();
+
+        /**
+        * Selects the instruction set of the inverse prediction kernels, InstructionSet_Auto by default.
+        * Decoded samples do not depend on the selection, which is meant for testing the kernels.
+        *
+        * @return false if iInstructionSet is not supported by the build or the CPU, the selection is then unchanged.
+        */
+        bool setInstructionSet(InstructionSet iInstructionSet);
+
+    private:
+
+        // Returns the direct form coefficients of iRegion, valid until the next call
+        const int32_t* getDirectFormCoeffs(const PredRegion &iRegion);
+
+        // Number of cache entries, a power of 2
+        static const uint32_t kCoeffCacheSize = 64;
+
+        struct CoeffCacheEntry
+        {
+            bool valid_;
+            uint5_t order_;
+            uint10_t kCoeff_[32];
+            int32_t coeffs_[32];
+        };
+
+        CoeffCacheEntry coeffCache_[kCoeffCacheSize];
+        uint64_t coeffCacheHits_;
+        uint64_t coeffCacheMisses_;
+
+        InstructionSet instructionSet_;
     };
 
 } // namespace dlc
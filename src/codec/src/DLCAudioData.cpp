@@ -27,22 +27,26 @@ THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 
 namespace dlc
 {
-    AudioData::AudioData() : shiftBits_(0), sampleRate_(eSampleRate_48000) {}
+    AudioData::AudioData() : shiftBits_(0), sampleRate_(eSampleRate_48000), numDLCSubBlocks_(0) {}
 
     AudioData::~AudioData()
     {
-        for (std::vector<ResidualSubBlock*>::iterator it = this->subBlocks48_.begin();
+        /* current_ is one of rice_ and pcm_ */
+
+        for (std::vector<SubBlockSlot>::iterator it = this->subBlocks48_.begin();
                 it < this->subBlocks48_.end();
                 it++)
         {
-            delete *it;
+            delete it->rice_;
+            delete it->pcm_;
         }
 
-        for (std::vector<ResidualSubBlock*>::iterator it = this->subBlocks96_.begin();
+        for (std::vector<SubBlockSlot>::iterator it = this->subBlocks96_.begin();
                 it < this->subBlocks96_.end();
                 it++)
         {
-            delete *it;
+            delete it->rice_;
+            delete it->pcm_;
         }
     }
 
@@ -127,7 +131,7 @@ namespace dlc
     {
         /* this cast is guaranteed by the range check in setNumDLCSubBlocks() */
 
-        return static_cast<uint8_t>(this->subBlocks48_.size());
+        return this->numDLCSubBlocks_;
     }
 
     void AudioData::setNumDLCSubBlocks(uint8_t iCount)
@@ -137,19 +141,25 @@ namespace dlc
             throw std::out_of_range("Number of sub blocks must be in the range [0, 255].");
         }
 
-        std::vector<ResidualSubBlock*>::iterator it48 = this->subBlocks48_.end();
-        std::vector<ResidualSubBlock*>::iterator it96 = this->subBlocks96_.end();
+        /* ST 2098-2 specifies that the number of 48 kHz and 96 kHz subblocks is identical */
 
-        for (uint8_t i = static_cast<uint8_t>(this->subBlocks48_.size()); i > iCount; i--)
+        if (this->subBlocks48_.size() < iCount)
         {
-            delete *(--it48);
-            delete *(--it96);
+            SubBlockSlot emptySlot = { NULL, NULL, NULL };
+
+            this->subBlocks48_.resize(iCount, emptySlot);
+            this->subBlocks96_.resize(iCount, emptySlot);
         }
 
-        /* ST 2098-2 specifies that the number of 48 kHz and 96 kHz subblocks is identical */
+        /* dropped sub blocks are kept in their slots for re-use, and are undefined when added back */
+
+        for (uint8_t i = iCount; i < this->numDLCSubBlocks_; i++)
+        {
+            this->subBlocks48_[i].current_ = NULL;
+            this->subBlocks96_[i].current_ = NULL;
+        }
 
-        this->subBlocks48_.resize(iCount);
-        this->subBlocks96_.resize(iCount);
+        this->numDLCSubBlocks_ = iCount;
     }
 
     void AudioData::initDLCSubBlock48(uint8_t iBlockIndex, CodeType iCodeType, uint32_t iResidualCount)
@@ -159,58 +169,93 @@ namespace dlc
             throw std::out_of_range("Sub block size must be in the range [0, 2^32-1].");
         }
 
-        if (this->subBlocks48_.at(iBlockIndex) != NULL)
+        if (iBlockIndex >= this->numDLCSubBlocks_)
         {
-            delete this->subBlocks48_.at(iBlockIndex);
+            throw std::out_of_range("Sub block index out of range.");
         }
 
-        switch (iCodeType)
-        {
-        case eCodeType_RICE_CODE_TYPE:
-            this->subBlocks48_.at(iBlockIndex) = new RiceResidualsSubBlock(iResidualCount);
-            break;
-        case eCodeType_PCM_CODE_TYPE:
-            this->subBlocks48_.at(iBlockIndex) = new PCMResidualsSubBlock(iResidualCount);
-            break;
-        }
+        initSubBlockSlot(this->subBlocks48_[iBlockIndex], iCodeType, iResidualCount);
     }
 
     ResidualSubBlock * AudioData::getDLCSubBlock48(uint8_t iBlockIndex)
     {
-        return this->subBlocks48_.at(iBlockIndex);
+        if (iBlockIndex >= this->numDLCSubBlocks_)
+        {
+            throw std::out_of_range("Sub block index out of range.");
+        }
+
+        return this->subBlocks48_[iBlockIndex].current_;
     }
 
     const ResidualSubBlock * AudioData::getDLCSubBlock48(uint8_t iBlockIndex) const
     {
-        return this->subBlocks48_.at(iBlockIndex);
+        if (iBlockIndex >= this->numDLCSubBlocks_)
+        {
+            throw std::out_of_range("Sub block index out of range.");
+        }
+
+        return this->subBlocks48_[iBlockIndex].current_;
     }
 
     void AudioData::initDLCSubBlock96(uint8_t iBlockIndex, CodeType iCodeType, uint32_t iResidualCount)
     {
-        if (this->subBlocks96_.at(iBlockIndex) != NULL)
+        if (iBlockIndex >= this->numDLCSubBlocks_)
         {
-            delete this->subBlocks96_.at(iBlockIndex);
+            throw std::out_of_range("Sub block index out of range.");
         }
 
-        switch (iCodeType)
-        {
-        case eCodeType_RICE_CODE_TYPE:
-            this->subBlocks96_.at(iBlockIndex) = new RiceResidualsSubBlock(iResidualCount);
-            break;
-        case eCodeType_PCM_CODE_TYPE:
-            this->subBlocks96_.at(iBlockIndex) = new PCMResidualsSubBlock(iResidualCount);
-            break;
-        }
+        initSubBlockSlot(this->subBlocks96_[iBlockIndex], iCodeType, iResidualCount);
     }
 
     ResidualSubBlock * AudioData::getDLCSubBlock96(uint8_t iBlockIndex)
     {
-        return this->subBlocks96_.at(iBlockIndex);
+        if (iBlockIndex >= this->numDLCSubBlocks_)
+        {
+            throw std::out_of_range("Sub block index out of range.");
+        }
+
+        return this->subBlocks96_[iBlockIndex].current_;
     }
 
     const ResidualSubBlock * AudioData::getDLCSubBlock96(uint8_t iBlockIndex) const
     {
-        return this->subBlocks96_.at(iBlockIndex);
+        if (iBlockIndex >= this->numDLCSubBlocks_)
+        {
+            throw std::out_of_range("Sub block index out of range.");
+        }
+
+        return this->subBlocks96_[iBlockIndex].current_;
+    }
+
+    void AudioData::initSubBlockSlot(SubBlockSlot &ioSlot, CodeType iCodeType, uint32_t iResidualCount)
+    {
+        switch (iCodeType)
+        {
+        case eCodeType_RICE_CODE_TYPE:
+            if (ioSlot.rice_ == NULL)
+            {
+                ioSlot.rice_ = new RiceResidualsSubBlock(iResidualCount);
+            }
+            else
+            {
+                ioSlot.rice_->reset(iResidualCount);
+            }
+
+            ioSlot.current_ = ioSlot.rice_;
+            break;
+        case eCodeType_PCM_CODE_TYPE:
+            if (ioSlot.pcm_ == NULL)
+            {
+                ioSlot.pcm_ = new PCMResidualsSubBlock(iResidualCount);
+            }
+            else
+            {
+                ioSlot.pcm_->reset(iResidualCount);
+            }
+
+            ioSlot.current_ = ioSlot.pcm_;
+            break;
+        }
     }
 
     uint32_t AudioData::getSampleCount48() const
@@ -277,6 +322,19 @@ namespace dlc
     {
     }
 
+    void RiceResidualsSubBlock::reset(uint32_t iSize)
+    {
+        if (iSize == 0)
+        {
+            throw std::out_of_range("Sub block cannot have zero length.");
+        }
+
+        /* assign() keeps the storage of residuals_ when it is large enough */
+
+        this->riceRemBits_ = 0;
+        this->residuals_.assign(iSize, 0);
+    }
+
     uint32_t RiceResidualsSubBlock::getSize() const
     {
         if (residuals_.size() > std::numeric_limits<uint32_t>::max())
@@ -307,16 +365,38 @@ namespace dlc
         this->riceRemBits_ = iNum;
     }
 
-    RiceResidual *RiceResidualsSubBlock::getResiduals()
+    int32_t * RiceResidualsSubBlock::getResiduals()
     {
         return &this->residuals_[0];
     }
 
-    const RiceResidual * RiceResidualsSubBlock::getResiduals() const
+    const int32_t * RiceResidualsSubBlock::getResiduals() const
     {
         return &this->residuals_[0];
     }
 
+    RiceResidual RiceResidualsSubBlock::getRiceResidual(uint32_t iIndex) const
+    {
+        int32_t value = this->residuals_.at(iIndex);
+        uint32_t magnitude = (value < 0) ? (0u - static_cast<uint32_t>(value)) : static_cast<uint32_t>(value);
+
+        RiceResidual residual;
+
+        residual.setQuotient(static_cast<int32_t>(magnitude >> this->riceRemBits_));
+        residual.setRemainder(static_cast<int32_t>(magnitude & ((1u << this->riceRemBits_) - 1)));
+        residual.setSign((value < 0) ? -1 : 1);
+
+        return residual;
+    }
+
+    void RiceResidualsSubBlock::setRiceResidual(uint32_t iIndex, const RiceResidual &iResidual)
+    {
+        // Same as sign * ((quotient << RiceRemBits) + remainder), wrapping around on overflow
+        uint32_t magnitude = (static_cast<uint32_t>(iResidual.getQuotient()) << this->riceRemBits_) + static_cast<uint32_t>(iResidual.getRemainder());
+
+        this->residuals_.at(iIndex) = static_cast<int32_t>((iResidual.getSign() < 0) ? (0u - magnitude) : magnitude);
+    }
+
     PCMResidualsSubBlock::PCMResidualsSubBlock(uint32_t iSize) : bitDepth_(0), residuals_(iSize)
     {
         if (iSize > std::numeric_limits<uint32_t>::max())
@@ -333,6 +413,17 @@ namespace dlc
     {
     }
 
+    void PCMResidualsSubBlock::reset(uint32_t iSize)
+    {
+        if (iSize == 0)
+        {
+            throw std::out_of_range("Sub block cannot have zero length.");
+        }
+
+        this->bitDepth_ = 0;
+        this->residuals_.assign(iSize, 0);
+    }
+
     uint32_t PCMResidualsSubBlock::getSize() const
     {
         if (residuals_.size() > std::numeric_limits<uint32_t>::max())
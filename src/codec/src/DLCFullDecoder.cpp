@@ -24,17 +24,352 @@ THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #include <algorithm>
 #include <stdexcept>
 
+#if !defined(DLC_DISABLE_SIMD) && (defined(__x86_64__) || defined(_M_X64))
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+#include <immintrin.h>
+#endif
+
 namespace dlc
 {
 // Embed legal text in DLC library binary and application executables that contain the DLC library
 const char *g_xperi_copyright_dlc = "DLCLib, Copyright (c) 2020 Xperi Corporation (and its subsidiaries). All rights reserved. Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the \"Software\"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions: The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software. THE SOFTWARE IS PROVIDED \"AS IS\", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.";
 
-	// Private structure that allows arrays of integers to be stores as elements of std::vector<>
-	struct _TempCoeffs
+	// *** Inverse prediction filter
+	//
+	// Each output sample is its residual plus the prediction -(sum of c[p] * output[n - p], p = 1..order) >> 20,
+	// accumulated on 64 bits. The kernels below are specialized per order: past outputs are kept in a linear
+	// history buffer, and the coefficients are stored reversed so that the taps of a sample are contiguous in
+	// memory. Products are summed modulo 2^64, so the result does not depend on the summation order and stays
+	// bit-exact with the sequential accumulation of ST 2098-2.
+	//
+	// The AVX2 and SSE4.1 kernels are selected at runtime on x86-64 targets. Define DLC_DISABLE_SIMD to build
+	// the scalar kernels only.
+
+	// Maximum predictor order, Order48 and Order96 are coded on 5 bits
+	static const int32_t kMaxPredictionOrder = 31;
+
+	// Number of most recent taps computed with scalar arithmetic by the vector kernels. These samples were
+	// output just before the current one; reading them back in a vector load would stall on the pending stores.
+	static const int32_t kRecentScalarTaps = 4;
+
+	// Linear buffer of past output samples, shared by all prediction regions of a layer. The kMaxPredictionOrder
+	// samples before position_ are the filter history. Once the buffer is full, they are moved back to its start.
+	struct PredictionHistory
+	{
+		static const uint32_t kLength = 1024;
+
+		int32_t samples_[kLength];
+		uint32_t position_;
+
+		void reset()
+		{
+			std::fill(samples_, samples_ + kMaxPredictionOrder, 0);
+			position_ = kMaxPredictionOrder;
+		}
+
+		// Returns the number of samples that can be appended without moving the history
+		uint32_t makeRoom()
+		{
+			if (position_ == kLength)
+			{
+				std::copy(samples_ + kLength - kMaxPredictionOrder, samples_ + kLength, samples_);
+				position_ = kMaxPredictionOrder;
+			}
+
+			return kLength - position_;
+		}
+	};
+
+	// Filters iSampleCount residuals in place, read and written every iStride samples
+	typedef void (*InversePredictor)(const int64_t *iReversedCoeffs
+		, PredictionHistory &ioHistory
+		, int32_t *ioSamples
+		, uint32_t iSampleCount
+		, int32_t iStride);
+
+	// Sum of the products of taps [First, End), iPast points to the oldest sample of the order
+	template<int32_t First, int32_t End>
+	static inline uint64_t SumOfProducts(const int64_t *iReversedCoeffs, const int32_t *iPast)
+	{
+		uint64_t sum = 0;
+
+		for (int32_t k = First; k < End; k++)
+		{
+			sum += static_cast<uint64_t>(iReversedCoeffs[k] * iPast[k]);
+		}
+
+		return sum;
+	}
+
+	// Output sample from its residual and the sum of products of the prediction
+	static inline int32_t PredictedSample(uint64_t iSumOfProducts, int32_t iResidual)
+	{
+		int32_t prediction = static_cast<int32_t>(static_cast<int64_t>(0 - iSumOfProducts) >> 20);
+
+		return static_cast<int32_t>(static_cast<uint32_t>(prediction) + static_cast<uint32_t>(iResidual));
+	}
+
+	// Scalar kernel
+	template<int32_t Order>
+	static void InversePredictScalar(const int64_t *iReversedCoeffs
+		, PredictionHistory &ioHistory
+		, int32_t *ioSamples
+		, uint32_t iSampleCount
+		, int32_t iStride)
+	{
+		while (iSampleCount > 0)
+		{
+			uint32_t count = std::min(iSampleCount, ioHistory.makeRoom());
+			int32_t *output = ioHistory.samples_ + ioHistory.position_;
+
+			for (uint32_t n = 0; n < count; n++)
+			{
+				output[n] = PredictedSample(SumOfProducts<0, Order>(iReversedCoeffs, output + n - Order), *ioSamples);
+				*ioSamples = output[n];
+				ioSamples += iStride;
+			}
+
+			ioHistory.position_ += count;
+			iSampleCount -= count;
+		}
+	}
+
+#if !defined(DLC_DISABLE_SIMD) && (defined(__x86_64__) || defined(_M_X64)) && \
+	(defined(_MSC_VER) || defined(__clang__) || (defined(__GNUC__) && (__GNUC__ > 4 || (__GNUC__ == 4 && __GNUC_MINOR__ >= 9))))
+
+#define DLC_X86_SIMD
+
+#if defined(_MSC_VER) && !defined(__clang__)
+#define DLC_TARGET_SSE41
+#define DLC_TARGET_AVX2
+#else
+#define DLC_TARGET_SSE41 __attribute__((target("sse4.1")))
+#define DLC_TARGET_AVX2 __attribute__((target("avx2")))
+#endif
+
+	// SSE4.1 kernel, 2 taps per vector
+	template<int32_t Order>
+	DLC_TARGET_SSE41 static void InversePredictSSE41(const int64_t *iReversedCoeffs
+		, PredictionHistory &ioHistory
+		, int32_t *ioSamples
+		, uint32_t iSampleCount
+		, int32_t iStride)
+	{
+		static const int32_t kVectorTaps = (Order > kRecentScalarTaps) ? ((Order - kRecentScalarTaps) & ~1) : 0;
+
+		__m128i coeffs[kVectorTaps / 2 + 1];
+
+		for (int32_t v = 0; v < kVectorTaps / 2; v++)
+		{
+			coeffs[v] = _mm_loadu_si128(reinterpret_cast<const __m128i*>(iReversedCoeffs + 2 * v));
+		}
+
+		while (iSampleCount > 0)
+		{
+			uint32_t count = std::min(iSampleCount, ioHistory.makeRoom());
+			int32_t *output = ioHistory.samples_ + ioHistory.position_;
+
+			for (uint32_t n = 0; n < count; n++)
+			{
+				const int32_t *past = output + n - Order;
+				__m128i sum2 = _mm_setzero_si128();
+
+				for (int32_t v = 0; v < kVectorTaps / 2; v++)
+				{
+					__m128i samples = _mm_cvtepi32_epi64(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(past + 2 * v)));
+					sum2 = _mm_add_epi64(sum2, _mm_mul_epi32(samples, coeffs[v]));
+				}
+
+				sum2 = _mm_add_epi64(sum2, _mm_unpackhi_epi64(sum2, sum2));
+
+				uint64_t sum = static_cast<uint64_t>(_mm_cvtsi128_si64(sum2)) + SumOfProducts<kVectorTaps, Order>(iReversedCoeffs, past);
+
+				output[n] = PredictedSample(sum, *ioSamples);
+				*ioSamples = output[n];
+				ioSamples += iStride;
+			}
+
+			ioHistory.position_ += count;
+			iSampleCount -= count;
+		}
+	}
+
+	// AVX2 kernel, 4 taps per vector
+	template<int32_t Order>
+	DLC_TARGET_AVX2 static void InversePredictAVX2(const int64_t *iReversedCoeffs
+		, PredictionHistory &ioHistory
+		, int32_t *ioSamples
+		, uint32_t iSampleCount
+		, int32_t iStride)
 	{
-		int32_t c_[32];
+		static const int32_t kVectorTaps = (Order > kRecentScalarTaps) ? ((Order - kRecentScalarTaps) & ~1) : 0;
+		static const int32_t kWideVectorTaps = kVectorTaps & ~3;
+
+		__m256i coeffs[kWideVectorTaps / 4 + 1];
+
+		for (int32_t v = 0; v < kWideVectorTaps / 4; v++)
+		{
+			coeffs[v] = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(iReversedCoeffs + 4 * v));
+		}
+
+		__m128i tailCoeffs = _mm_setzero_si128();
+
+		if (kVectorTaps != kWideVectorTaps)
+		{
+			tailCoeffs = _mm_loadu_si128(reinterpret_cast<const __m128i*>(iReversedCoeffs + kWideVectorTaps));
+		}
+
+		while (iSampleCount > 0)
+		{
+			uint32_t count = std::min(iSampleCount, ioHistory.makeRoom());
+			int32_t *output = ioHistory.samples_ + ioHistory.position_;
+
+			for (uint32_t n = 0; n < count; n++)
+			{
+				const int32_t *past = output + n - Order;
+				__m256i sum4 = _mm256_setzero_si256();
+
+				for (int32_t v = 0; v < kWideVectorTaps / 4; v++)
+				{
+					__m256i samples = _mm256_cvtepi32_epi64(_mm_loadu_si128(reinterpret_cast<const __m128i*>(past + 4 * v)));
+					sum4 = _mm256_add_epi64(sum4, _mm256_mul_epi32(samples, coeffs[v]));
+				}
+
+				__m128i sum2 = _mm_add_epi64(_mm256_castsi256_si128(sum4), _mm256_extracti128_si256(sum4, 1));
+
+				if (kVectorTaps != kWideVectorTaps)
+				{
+					__m128i samples = _mm_cvtepi32_epi64(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(past + kWideVectorTaps)));
+					sum2 = _mm_add_epi64(sum2, _mm_mul_epi32(samples, tailCoeffs));
+				}
+
+				sum2 = _mm_add_epi64(sum2, _mm_unpackhi_epi64(sum2, sum2));
+
+				uint64_t sum = static_cast<uint64_t>(_mm_cvtsi128_si64(sum2)) + SumOfProducts<kVectorTaps, Order>(iReversedCoeffs, past);
+
+				output[n] = PredictedSample(sum, *ioSamples);
+				*ioSamples = output[n];
+				ioSamples += iStride;
+			}
+
+			ioHistory.position_ += count;
+			iSampleCount -= count;
+		}
+	}
+
+#endif // DLC_X86_SIMD
+
+#define DLC_INVERSE_PREDICTORS(kernel) \
+	{ \
+		kernel<0>, kernel<1>, kernel<2>, kernel<3>, kernel<4>, kernel<5>, kernel<6>, kernel<7>, \
+		kernel<8>, kernel<9>, kernel<10>, kernel<11>, kernel<12>, kernel<13>, kernel<14>, kernel<15>, \
+		kernel<16>, kernel<17>, kernel<18>, kernel<19>, kernel<20>, kernel<21>, kernel<22>, kernel<23>, \
+		kernel<24>, kernel<25>, kernel<26>, kernel<27>, kernel<28>, kernel<29>, kernel<30>, kernel<31> \
+	}
+
+	static const InversePredictor kScalarInversePredictors[kMaxPredictionOrder + 1] = DLC_INVERSE_PREDICTORS(InversePredictScalar);
+
+#ifdef DLC_X86_SIMD
+	static const InversePredictor kSSE41InversePredictors[kMaxPredictionOrder + 1] = DLC_INVERSE_PREDICTORS(InversePredictSSE41);
+	static const InversePredictor kAVX2InversePredictors[kMaxPredictionOrder + 1] = DLC_INVERSE_PREDICTORS(InversePredictAVX2);
+#endif
+
+#ifdef DLC_X86_SIMD
+	// Instruction sets supported by the CPU and operating system
+	struct InstructionSets
+	{
+		bool hasSSE41_;
+		bool hasAVX2_;
 	};
 
+	static InstructionSets DetectInstructionSets()
+	{
+		InstructionSets sets;
+
+#if defined(_MSC_VER) && !defined(__clang__)
+		int info[4];
+
+		__cpuid(info, 0);
+		int maxLeaf = info[0];
+
+		__cpuid(info, 1);
+		bool hasOSAVX = ((info[2] & (1 << 27)) != 0) && ((info[2] & (1 << 28)) != 0) && ((_xgetbv(0) & 6) == 6);
+
+		sets.hasSSE41_ = (info[2] & (1 << 19)) != 0;
+		sets.hasAVX2_ = false;
+
+		if (hasOSAVX && maxLeaf >= 7)
+		{
+			__cpuidex(info, 7, 0);
+			sets.hasAVX2_ = (info[1] & (1 << 5)) != 0;
+		}
+#else
+		__builtin_cpu_init();
+		sets.hasSSE41_ = __builtin_cpu_supports("sse4.1") != 0;
+		sets.hasAVX2_ = __builtin_cpu_supports("avx2") != 0;
+#endif
+
+		return sets;
+	}
+#endif // DLC_X86_SIMD
+
+	// Returns the kernel table for iInstructionSet, NULL if the build or the CPU does not support it
+	static const InversePredictor* GetInversePredictors(FullDecoder::InstructionSet iInstructionSet)
+	{
+#ifdef DLC_X86_SIMD
+		static const InstructionSets supportedSets = DetectInstructionSets();
+
+		switch (iInstructionSet)
+		{
+		case FullDecoder::InstructionSet_Auto:
+			return supportedSets.hasAVX2_ ? kAVX2InversePredictors
+				: (supportedSets.hasSSE41_ ? kSSE41InversePredictors : kScalarInversePredictors);
+
+		case FullDecoder::InstructionSet_Scalar:
+			return kScalarInversePredictors;
+
+		case FullDecoder::InstructionSet_SSE41:
+			return supportedSets.hasSSE41_ ? kSSE41InversePredictors : NULL;
+
+		case FullDecoder::InstructionSet_AVX2:
+			return supportedSets.hasAVX2_ ? kAVX2InversePredictors : NULL;
+		}
+#else
+		if ((iInstructionSet == FullDecoder::InstructionSet_Auto) || (iInstructionSet == FullDecoder::InstructionSet_Scalar))
+		{
+			return kScalarInversePredictors;
+		}
+#endif
+
+		return NULL;
+	}
+
+	// Reverses the direct form coefficients of a region into oReversedCoeffs and returns the kernel for its order
+	static InversePredictor setupInversePredictor(const InversePredictor *iInversePredictors, const int32_t iCoeffs[32], uint5_t iOrder, int64_t oReversedCoeffs[kMaxPredictionOrder])
+	{
+		for (int32_t k = 0; k < iOrder; k++)
+		{
+			oReversedCoeffs[k] = iCoeffs[iOrder - k];
+		}
+
+		return iInversePredictors[iOrder];
+	}
+
+	FullDecoder::FullDecoder()
+	{
+		for (uint32_t i = 0; i < kCoeffCacheSize; i++)
+		{
+			coeffCache_[i].valid_ = false;
+		}
+
+		coeffCacheHits_ = 0;
+		coeffCacheMisses_ = 0;
+
+		instructionSet_ = InstructionSet_Auto;
+	}
+
 	// *** See ST 2098-2 for a description of the algorithm.
 	//
 	void FullDecoder::decode(int32_t * oSamples
@@ -109,79 +444,37 @@ const char *g_xperi_copyright_dlc = "DLCLib, Copyright (c) 2020 Xperi Corporatio
 				throw std::runtime_error("At least one 48 kHz DLC Subblock is undefined.");
 			}
 
-			// inverse entropy coding
-
-			if (rsb->getCodeType() == eCodeType_PCM_CODE_TYPE)
-			{
-				const PCMResidualsSubBlock *pcmr = static_cast<const PCMResidualsSubBlock*>(rsb);
+			// inverse entropy coding is done when parsing, PCM and Rice/Golomb residuals are both held as values
 
-				const int32_t *curRes = pcmr->getResiduals();
-				const int32_t *endRes = curRes + pcmr->getSize();
+			const int32_t *curRes = (rsb->getCodeType() == eCodeType_PCM_CODE_TYPE)
+				? static_cast<const PCMResidualsSubBlock*>(rsb)->getResiduals()
+				: static_cast<const RiceResidualsSubBlock*>(rsb)->getResiduals();
+			const int32_t *endRes = curRes + rsb->getSize();
 
-				while (curRes < endRes)
-				{
-					*curSample = *curRes;
-					curRes++;
-					curSample += stride48;
-				}
+			if (stride48 == 1)
+			{
+				curSample = std::copy(curRes, endRes, curSample);
 			}
 			else
 			{
-				const RiceResidualsSubBlock *res = static_cast<const RiceResidualsSubBlock*>(rsb);
-
-				const RiceResidual * curRes = res->getResiduals();
-				const RiceResidual *endRes = curRes + res->getSize();
-
 				while (curRes < endRes)
 				{
-					*curSample = curRes->getSign() * ((curRes->getQuotient() << res->getRiceRemBits()) + curRes->getRemainder());
+					*curSample = *curRes;
 					curRes++;
 					curSample += stride48;
 				}
 			}
 		}  // End of "for (uint8_t i = 0; i < iDLCData.getNumDLCSubBlocks(); i++)"
 
-		// 48 kHz Lattice Prediction Coefficients to Direct Form Coefficients
-
-		std::vector<_TempCoeffs> aCoeffs48(iDLCData.getNumPredRegions48());
-
-		for (uint2_t n = 0; n < iDLCData.getNumPredRegions48(); n++)
-		{
-			int32_t aCoeffsTemp[32];
-
-			aCoeffs48[n].c_[0] = 1048576;
-
-			const PredRegion &pr = iDLCData.getPredRegion48(n);
-
-			for (int32_t j = 1; j <= pr.getOrder(); j++)
-			{
-				int32_t kCoeff48_nj = pr.getKCoeff()[j];
-
-				kCoeff48_nj -= 512;
-				kCoeff48_nj <<= 11;
-
-				aCoeffs48[n].c_[j] = 0;
-
-				for (int32_t k = 1; k <= j; k++)
-				{
-					int64_t accum64 = static_cast<int64_t>(kCoeff48_nj) * aCoeffs48[n].c_[j - k];
-					aCoeffsTemp[k] = aCoeffs48[n].c_[k] + static_cast<int32_t>(accum64 >> 20);
-				}
-
-				for (int32_t k = 1; k <= j; k++)
-				{
-					aCoeffs48[n].c_[k] = aCoeffsTemp[k];
-				}
-			}
-		}  // End of "for (uint2_t n = 0; n < iDLCData.getNumPredRegions48(); n++)"
-
 		// apply filters to 48 KHz residuals
 
 		curSample = oSamples;
 
-		int32_t buffer[64] = { 0 };
+		PredictionHistory history;
 
-		int32_t index1 = 0;
+		history.reset();
+
+		const InversePredictor *inversePredictors = GetInversePredictors(instructionSet_);
 
 		uint8_t curBlock = 0;
 
@@ -193,6 +486,9 @@ const char *g_xperi_copyright_dlc = "DLCLib, Copyright (c) 2020 Xperi Corporatio
 			{
 				const PredRegion &pr = iDLCData.getPredRegion48(i);
 
+				int64_t reversedCoeffs[kMaxPredictionOrder];
+				InversePredictor predict = setupInversePredictor(inversePredictors, getDirectFormCoeffs(pr), pr.getOrder(), reversedCoeffs);
+
 				for (uint4_t j = 0; j < pr.getRegionLength(); j++)
 				{
 					const ResidualSubBlock *rsb = iDLCData.getDLCSubBlock48(curBlock);
@@ -202,30 +498,8 @@ const char *g_xperi_copyright_dlc = "DLCLib, Copyright (c) 2020 Xperi Corporatio
 						throw std::runtime_error("At least one 48 kHz DLC Subblock is undefined.");
 					}
 
-					for (uint32_t k = 0; k < rsb->getSize(); k++)
-					{
-						int32_t index2 = index1;
-						int64_t accum64 = 0;
-
-						for (int32_t p = 1; p <= pr.getOrder(); p++)
-						{
-							accum64 -= (static_cast<int64_t>(buffer[index2]) *
-								static_cast<int64_t>(aCoeffs48[i].c_[p]));
-
-							index2--;
-							index2 &= 63;
-						}
-
-						int32_t output = static_cast<int32_t>(accum64 >> 20);
-						output += *curSample;
-
-						index1++;
-						index1 &= 63;
-						buffer[index1] = output;
-
-						*curSample = output;
-						curSample += stride48;
-					}
+					predict(reversedCoeffs, history, curSample, rsb->getSize(), stride48);
+					curSample += rsb->getSize() * stride48;
 				}
 			}
 		}  // End of "if (iDLCData.getNumPredRegions48() > 0)"
@@ -249,71 +523,18 @@ const char *g_xperi_copyright_dlc = "DLCLib, Copyright (c) 2020 Xperi Corporatio
 					throw std::runtime_error("At least one 96 kHz DLC Subblock is undefined.");
 				}
 
-				if (rsb->getCodeType() == eCodeType_PCM_CODE_TYPE)
-				{
-					const PCMResidualsSubBlock *pcmr = static_cast<const PCMResidualsSubBlock*>(rsb);
-
-					std::copy(pcmr->getResiduals(), pcmr->getResiduals() + pcmr->getSize(), curResidual96);
-
-					curResidual96 += pcmr->getSize();
-				}
-				else
-				{
-					const RiceResidualsSubBlock *res = static_cast<const RiceResidualsSubBlock*>(rsb);
-
-					const RiceResidual *curRes = res->getResiduals();
-					const RiceResidual *endRes = res->getResiduals() + res->getSize();
-
-					while (curRes < endRes)
-					{
-						*(curResidual96++) = curRes->getSign() * ((curRes->getQuotient() << res->getRiceRemBits()) + curRes->getRemainder());
+				const int32_t *curRes = (rsb->getCodeType() == eCodeType_PCM_CODE_TYPE)
+					? static_cast<const PCMResidualsSubBlock*>(rsb)->getResiduals()
+					: static_cast<const RiceResidualsSubBlock*>(rsb)->getResiduals();
 
-						curRes++;
-					}
-				}
+				curResidual96 = std::copy(curRes, curRes + rsb->getSize(), curResidual96);
 			}  // End of "for (uint8_t i = 0; i < iDLCData.getNumDLCSubBlocks(); i++)"
 
-			// 96 kHz Lattice Prediction Coefficients to Direct Form Coefficients
-
-			std::vector<_TempCoeffs> aCoeffs96(iDLCData.getNumPredRegions96());
-
-			for (uint2_t n = 0; n < iDLCData.getNumPredRegions96(); n++)
-			{
-				int32_t aCoeffsTemp[32];
-
-				aCoeffs96[n].c_[0] = 1048576;
-
-				const PredRegion &pr = iDLCData.getPredRegion48(n);
-
-				for (int32_t j = 1; j <= pr.getOrder(); j++)
-				{
-					int32_t kCoeff96_nj = pr.getKCoeff()[j];
-
-					kCoeff96_nj -= 512;
-					kCoeff96_nj <<= 11;
-
-					aCoeffs96[n].c_[j] = 0;
-
-					for (int32_t k = 1; k <= j; k++)
-					{
-						int64_t accum64 = static_cast<int64_t>(kCoeff96_nj) * aCoeffs96[n].c_[j - k];
-						aCoeffsTemp[k] = aCoeffs96[n].c_[k] + static_cast<int32_t>(accum64 >> 20);
-					}
-
-					for (int32_t k = 1; k <= j; k++)
-					{
-						aCoeffs96[n].c_[k] = aCoeffsTemp[k];
-					}
-				}
-			}  // End of "for (uint2_t n = 0; n < iDLCData.getNumPredRegions96(); n++)"
-
 			// apply filters to 96 KHz residuals
 
-			curResidual96 = residuals96.begin();
-
-			std::fill(buffer, (buffer + 64), 0);
+			int32_t *curSample96 = &residuals96[0];
 
-			index1 = 0;
+			history.reset();
 
 			curBlock = 0;
 
@@ -325,6 +546,10 @@ const char *g_xperi_copyright_dlc = "DLCLib, Copyright (c) 2020 Xperi Corporatio
 				{
 					const PredRegion &pr = iDLCData.getPredRegion96(i);
 
+					// As in the reference decoder, 96 kHz coefficients are derived from the 48 kHz region of the same index
+					int64_t reversedCoeffs[kMaxPredictionOrder];
+					InversePredictor predict = setupInversePredictor(inversePredictors, getDirectFormCoeffs(iDLCData.getPredRegion48(i)), pr.getOrder(), reversedCoeffs);
+
 					for (uint8_t j = 0; j < pr.getRegionLength(); j++)
 					{
 						const ResidualSubBlock *rsb = iDLCData.getDLCSubBlock96(curBlock);
@@ -334,38 +559,17 @@ const char *g_xperi_copyright_dlc = "DLCLib, Copyright (c) 2020 Xperi Corporatio
 							throw std::runtime_error("At least one 96 kHz DLC Subblock is undefined.");
 						}
 
-						for (uint16_t k = 0; k < rsb->getSize(); k++)
-						{
-							int32_t index2 = index1;
-							int64_t accum64 = 0;
-
-							for (int32_t p = 1; p <= pr.getOrder(); p++)
-							{
-								accum64 -= (static_cast<int64_t>(buffer[index2]) *
-									static_cast<int64_t>(aCoeffs96[i].c_[p]));
-
-								index2--;
-								index2 &= 63;
-							}
-
-							int32_t output = static_cast<int32_t>(accum64 >> 20);
-							output += *curResidual96;
-
-							index1++;
-							index1 &= 63;
-							buffer[index1] = output;
-
-							*curResidual96++ = output;
-						}
+						predict(reversedCoeffs, history, curSample96, rsb->getSize(), 1);
+						curSample96 += rsb->getSize();
 					}
 				}
 			}  // End of "for (uint2_t n = 0; n < iDLCData.getNumPredRegions96(); n++)"
 
 			// upsample 48 kHz samples to 96 kHz and add 96 Hz residuals
 
-			std::fill(buffer, (buffer + 64), 0);
+			int32_t buffer[64] = { 0 };
 
-			index1 = 0;
+			int32_t index1 = 0;
 
 			curSample = oSamples;
 
@@ -427,4 +631,96 @@ const char *g_xperi_copyright_dlc = "DLCLib, Copyright (c) 2020 Xperi Corporatio
 		return StatusCode_OK;
 	}
 
+	uint64_t FullDecoder::getCoeffCacheHits() const
+	{
+		return coeffCacheHits_;
+	}
+
+	uint64_t FullDecoder::getCoeffCacheMisses() const
+	{
+		return coeffCacheMisses_;
+	}
+
+	void FullDecoder::resetCoeffCacheCounters()
+	{
+		coeffCacheHits_ = 0;
+		coeffCacheMisses_ = 0;
+	}
+
+	bool FullDecoder::setInstructionSet(InstructionSet iInstructionSet)
+	{
+		if (GetInversePredictors(iInstructionSet) == NULL)
+		{
+			return false;
+		}
+
+		instructionSet_ = iInstructionSet;
+
+		return true;
+	}
+
+	// *** Lattice Prediction Coefficients to Direct Form Coefficients
+	//
+	// The cache is direct mapped on a hash of the order and of the lattice coefficients in use. An entry is
+	// reused only when both match exactly, otherwise it is overwritten with the new conversion.
+	//
+	const int32_t* FullDecoder::getDirectFormCoeffs(const PredRegion &iRegion)
+	{
+		const uint5_t order = iRegion.getOrder();
+		const uint10_t *kCoeff = iRegion.getKCoeff();
+
+		// FNV-1a
+		uint32_t hash = 2166136261u;
+
+		hash = (hash ^ order) * 16777619u;
+
+		for (int32_t j = 1; j <= order; j++)
+		{
+			hash = (hash ^ kCoeff[j]) * 16777619u;
+		}
+
+		CoeffCacheEntry &entry = coeffCache_[(hash ^ (hash >> 16)) & (kCoeffCacheSize - 1)];
+
+		if (entry.valid_ && entry.order_ == order && std::equal(kCoeff + 1, kCoeff + order + 1, entry.kCoeff_ + 1))
+		{
+			coeffCacheHits_++;
+			return entry.coeffs_;
+		}
+
+		coeffCacheMisses_++;
+
+		int32_t *coeffs = entry.coeffs_;
+		int32_t aCoeffsTemp[32];
+
+		// Coefficients above the order are left to 0, the 96 kHz layer may run a higher order filter on them
+		std::fill(coeffs, coeffs + 32, 0);
+
+		coeffs[0] = 1048576;
+
+		for (int32_t j = 1; j <= order; j++)
+		{
+			int32_t kCoeff_j = kCoeff[j];
+
+			kCoeff_j -= 512;
+			kCoeff_j <<= 11;
+
+			for (int32_t k = 1; k <= j; k++)
+			{
+				int64_t accum64 = static_cast<int64_t>(kCoeff_j) * coeffs[j - k];
+				aCoeffsTemp[k] = coeffs[k] + static_cast<int32_t>(accum64 >> 20);
+			}
+
+			for (int32_t k = 1; k <= j; k++)
+			{
+				coeffs[k] = aCoeffsTemp[k];
+			}
+		}
+
+		std::copy(kCoeff, kCoeff + 32, entry.kCoeff_);
+		entry.order_ = order;
+		entry.valid_ = true;
+
+		return entry.coeffs_;
+	}
+
 } // namespace dlc
@@ -1092,6 +1092,70 @@ namespace CommonStream
         ReturnCode rc = OK;
 
         oVal = 0;
+
+        // Plex<4> and Plex<8> are decoded from the reader's word lookahead. With k escape
+        // fields in front, the value field is (N << k) bits wide and the whole code takes
+        // (N << (k + 1)) - N bits. Past the first field, the escape level is worked out
+        // from the word without branching on each field.
+        //
+        if (N == 4 || N == 8)
+        {
+            const uint32_t maxLevelBits = (N << 3) - N;
+            const uint64_t mask1 = (static_cast<uint64_t>(1) << N) - 1;
+            const uint64_t mask2 = (static_cast<uint64_t>(1) << (N << 1)) - 1;
+            const uint64_t mask4 = (static_cast<uint64_t>(1) << (N << 2)) - 1;
+
+            uint64_t bits = 0;
+            uint32_t numBits = 0;
+
+            rc = bsr.lookahead(bits, numBits, static_cast<uint8_t>(N));
+
+            if (rc != OK)
+            {
+                return rc;
+            }
+
+            // No escape, the common case
+            //
+            if (numBits >= N && (bits >> (64 - N)) != mask1)
+            {
+                oVal = static_cast<uint32_t>(bits >> (64 - N));
+
+                return bsr.skip(static_cast<uint8_t>(N));
+            }
+
+            // Escaped: top the lookahead up to the longest code that fits it, unless it
+            // is clear from the bits at hand that the code ends earlier
+            //
+            if (numBits < 3 * N ||
+                (numBits < maxLevelBits && ((bits >> (64 - 3 * N)) & mask2) == mask2))
+            {
+                rc = bsr.lookahead(bits, numBits, static_cast<uint8_t>(maxLevelBits));
+
+                if (rc != OK)
+                {
+                    return rc;
+                }
+            }
+
+            uint32_t escape1 = (((bits >> (64 - 3 * N)) & mask2) == mask2);
+            uint32_t escape2 = escape1 & (((bits >> (64 - maxLevelBits)) & mask4) == mask4);
+
+            uint32_t level = 1 + escape1 + escape2;
+            uint32_t valueBits = N << level;
+            uint32_t totalBits = (N << (level + 1)) - N;
+
+            // A 32-bit value field, or a code running past the end of
+            // the stream, is left to the field by field decoder below
+            //
+            if (level < 3 && totalBits <= numBits)
+            {
+                oVal = static_cast<uint32_t>((bits >> (64 - totalBits)) & ((static_cast<uint64_t>(1) << valueBits) - 1));
+
+                return bsr.skip(static_cast<uint8_t>(totalBits));
+            }
+        }
+
         uint32_t bitsToRead = N;
         uint32_t value = 0;
         
@@ -1127,6 +1191,57 @@ namespace CommonStream
         return PARAMS_BAD;
     }
 
+    template <typename StreamType, uint32_t N>
+    ReturnCode peek(BitStreamReaderT<StreamType>& bsr, Plex<N> &oVal)
+    {
+        ReturnCode rc = OK;
+
+        oVal = 0;
+        uint32_t bitsToRead = N;
+        uint32_t bitsBefore = 0;
+        uint64_t bits = 0;
+
+        // Escape sequences are looked at in the reader's lookahead,
+        // leaving the stream position alone
+        //
+        while (bitsToRead <= 32)
+        {
+            if (bitsBefore + bitsToRead > 57)
+            {
+                // Too long for the lookahead (32-bit Plex<4> value),
+                // fall back to a state restoring read
+                //
+                BitStreamStateRestorerT<StreamType> restorer(&bsr);
+
+                return read(bsr, oVal);
+            }
+
+            rc = bsr.lookahead(bits, static_cast<uint8_t>(bitsBefore + bitsToRead));
+
+            if (rc != OK)
+            {
+                return rc;
+            }
+
+            uint64_t maxValue = 1;
+            maxValue = (maxValue << bitsToRead) - 1;
+
+            uint32_t value = static_cast<uint32_t>(bits & maxValue);
+
+            if (value < maxValue)
+            {
+                oVal = value;
+
+                return OK;
+            }
+
+            bitsBefore += bitsToRead;
+            bitsToRead = bitsToRead << 1;
+        }
+
+        return PARAMS_BAD;
+    }
+
 }  // namespace CommonStream
 
 #endif // COMMON_STREAM_SRC_BITSTREAM_BITSTREAMIOHELPERS_H_
@@ -51,6 +51,8 @@ namespace CommonStream
         bitCount_ = 0;
         bufferLengthInBits_ = std::numeric_limits<BitCount_t>::max();
 
+        initLookahead();
+
 #ifdef CMNSTRM_USE_CHECK_SUM
         hash_ = nullptr;
         CRC_ = nullptr;
@@ -62,6 +64,7 @@ namespace CommonStream
     template<>
     BitStreamReaderT<std::ifstream>::~BitStreamReaderT()
     {
+        delete [] blockBuffer_;
     }
 
     template<>
@@ -74,6 +77,8 @@ namespace CommonStream
         bitCount_ = 0;
         bufferLengthInBits_ = std::numeric_limits<BitCount_t>::max();
 
+        initLookahead();
+
 #ifdef CMNSTRM_USE_CHECK_SUM
         hash_ = nullptr;
         CRC_ = nullptr;
@@ -85,6 +90,7 @@ namespace CommonStream
     template<>
     BitStreamReaderT<std::istream>::~BitStreamReaderT()
     {
+        delete [] blockBuffer_;
     }
 
     template<>
@@ -124,6 +130,8 @@ namespace CommonStream
     template<>
     ReturnCode BitStreamReaderT<RawIStream>::Init(const BitStreamReaderT<RawIStream> &bs2)
     {
+        initLookahead();
+
         if ( stream_ )
         {
             delete stream_;
@@ -174,6 +182,7 @@ namespace CommonStream
                 }
             }
             BitStreamStateT<RawIStream> state = bs2.getState();
+            initLookahead();
             setState(state);
 #endif // #ifndef __clang_analyzer__
         }
@@ -186,6 +195,42 @@ namespace CommonStream
         delete stream_;
     }
 
+    // The memory stream's own buffer serves as lookahead: all remaining bytes are
+    // handed out at once, without copying, whatever the block read size.
+
+    template<>
+    size_t BitStreamReaderT<RawIStream>::fetch(void)
+    {
+        BitCount_t pos = stream_->tellg();
+
+        if (pos < stream_->buffer_size())
+        {
+            const uint8_t *block = reinterpret_cast<const uint8_t *>(stream_->buffer()) + pos;
+            BitCount_t numBytes = stream_->buffer_size() - pos;
+
+            stream_->seekg(static_cast<std::ios_base::streampos>(stream_->buffer_size()));
+
+            lookaheadBase_ = block;
+            lookaheadBasePos_ = static_cast<std::ios_base::streampos>(pos);
+            lookaheadPtr_ = block;
+            lookaheadEnd_ = block + numBytes;
+
+            return static_cast<size_t>(numBytes);
+        }
+
+        // Let the stream flag end of data
+        //
+        char c;
+
+        stream_->get(c);
+
+        lookaheadBase_ = nullptr;
+        lookaheadPtr_ = nullptr;
+        lookaheadEnd_ = nullptr;
+
+        return 0;
+    }
+
     template<>
     char *BitStreamReaderT<RawIStream>::buffer() const
     {
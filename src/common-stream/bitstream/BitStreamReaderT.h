@@ -26,6 +26,7 @@ THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #include <string.h>
 #include <istream>
 #include <climits>
+#include <new>
 
 #include "Namespace.h"
 #include "BitStreamStateT.h"
@@ -37,6 +38,8 @@ THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 
 namespace CommonStream
 {
+    class RawIStream;
+
     template<typename StreamType> class BitStreamReaderT;
 
     template<typename StreamType>
@@ -122,15 +125,48 @@ namespace CommonStream
         ReturnCode Init(const BitStreamReaderT<StreamType> &bs2);
         BitStreamReaderT<StreamType> &operator=(const BitStreamReaderT<StreamType> &bs2);
 
+        // Stream position of the next byte not yet (even partially) consumed by the reader.
+        // Bytes buffered ahead in the word buffer or block lookahead are not counted as consumed.
         std::ios_base::streampos streamPosition() const
         {
-            return stream_->tellg();
+            std::streamoff wordBytes = static_cast<std::streamoff>(wordBufferFill_ >> 3);
+
+            if (lookaheadBase_ != nullptr)
+            {
+                return lookaheadBasePos_ + static_cast<std::streamoff>(lookaheadPtr_ - lookaheadBase_) - wordBytes;
+            }
+
+            std::ios_base::streampos pos = stream_->tellg();
+            std::streamoff buffered = static_cast<std::streamoff>(lookaheadEnd_ - lookaheadPtr_) + wordBytes;
+
+            if (buffered == 0 || pos == std::ios_base::streampos(-1))
+            {
+                return pos;
+            }
+
+            return pos - buffered;
         }
         
 		StreamType& streamPosition(std::ios_base::streampos sp)
         {
-            return stream_->seekg(sp);
+            if (!seekWithinLookahead(sp))
+            {
+                dropLookahead();
+                stream_->seekg(sp);
+            }
+
+            return *stream_;
         }
+
+        // Block read mode. When iNumBytes is non-zero, the reader refills its word buffer from
+        // blocks of iNumBytes taken from the stream buffer in one call, instead of a get() per byte.
+        // The stream is then positioned ahead of the reader; use releaseLookahead() before handing
+        // the stream to anyone else. RawIStream readers always read straight from memory.
+        ReturnCode setBlockReadSize(uint32_t iNumBytes);
+
+        // Seeks the stream back over any bytes read ahead, so that the stream position matches
+        // streamPosition(). Bits left over from a partially consumed byte are kept.
+        ReturnCode releaseLookahead(void);
         
         ReturnCode read(uint8_t &oVal, uint8_t iNumBits);
         ReturnCode read(uint16_t &oVal, uint8_t iNumBits);
@@ -180,7 +216,53 @@ namespace CommonStream
         ReturnCode peek(int32_t &oVal);
         ReturnCode peek(int64_t &oVal);
 
-        ReturnCode skip(uint8_t iNumbits);
+        // Peeks at the next iNumBits bits (at most 57) without consuming them. Unlike peek(), the
+        // reader state is not saved and restored: the bits are served from the word buffer and block
+        // lookahead, pulling more bytes from the stream as needed, and stay buffered for the next read.
+        ReturnCode lookahead(uint64_t &oVal, uint8_t iNumBits);
+
+        // Word level lookahead for decoders: tops the word buffer up to at least iNumBits bits (at most 57)
+        // where the stream allows, then returns all buffered bits MSB aligned, and how many there are.
+        // Nothing is consumed, use skip() for that.
+        ReturnCode lookahead(uint64_t &oBits, uint32_t &oNumBits, uint8_t iNumBits)
+        {
+            if (wordBufferFill_ >= iNumBits && error_ == OK && stream_->good() &&
+                bitCount_ + wordBufferFill_ <= bufferLengthInBits_)
+            {
+                oBits = wordBuffer_;
+                oNumBits = wordBufferFill_;
+
+                return OK;
+            }
+
+            return lookaheadFill(oBits, oNumBits, iNumBits);
+        }
+
+        // Skips iNumbits bits. Bits already in the word buffer, such as those returned by lookahead(), are
+        // dropped in place. The hash has seen them when they were buffered, the CRC is given them here, as
+        // read() would.
+        ReturnCode skip(uint8_t iNumbits)
+        {
+            if (iNumbits <= wordBufferFill_ && error_ == OK && stream_->good() &&
+                bitCount_ + iNumbits <= bufferLengthInBits_)
+            {
+#ifdef CMNSTRM_USE_CHECK_SUM
+                if (CRC_ && CRC_->useCRC() && iNumbits > 0)
+                {
+                    CRC_->accumulate(static_cast<uint64_t>(wordBuffer_ >> (64 - iNumbits)), iNumbits);
+                }
+#endif // #ifdef CMNSTRM_USE_CHECK_SUM
+
+                wordBuffer_ = (iNumbits < 64) ? (wordBuffer_ << iNumbits) : 0;
+                wordBufferFill_ -= iNumbits;
+                bitCount_ += iNumbits;
+
+                return OK;
+            }
+
+            return skip(static_cast<BitCount_t>(iNumbits));
+        }
+
         ReturnCode skip(BitCount_t iNumbits);
         ReturnCode skipAligned(uint8_t iNumbytes);
 
@@ -221,14 +303,58 @@ namespace CommonStream
 
         ReturnCode read_unchecked(uint32_t &oVal, uint8_t iNumBits);
 
+        void initLookahead(void);
+        void dropLookahead(void);
+        bool seekWithinLookahead(std::ios_base::streampos iPos);
+        ReturnCode fill(uint8_t iNumBits);
+        ReturnCode lookaheadFill(uint64_t &oBits, uint32_t &oNumBits, uint8_t iNumBits);
+        size_t fetch(void);
+
         StreamType		*stream_;
 
+        // wordBuffer_ holds the next wordBufferFill_ unread bits, MSB aligned, with all lower bits zero.
+        // [lookaheadPtr_, lookaheadEnd_) are bytes taken from the stream but not yet moved to wordBuffer_.
+        // For block reads, lookaheadBase_ is the start of the current block and lookaheadBasePos_ its
+        // stream position, which lets positions inside the block be restored without seeking.
+        uint64_t                    wordBuffer_;
+        uint32_t                    wordBufferFill_;
+        const uint8_t               *lookaheadPtr_;
+        const uint8_t               *lookaheadEnd_;
+        const uint8_t               *lookaheadBase_;
+        std::ios_base::streampos    lookaheadBasePos_;
+        uint8_t                     *blockBuffer_;
+        uint32_t                    blockReadSize_;
+        uint8_t                     lookaheadByte_;
+
 #ifdef CMNSTRM_USE_CHECK_SUM
         CRCGenerator		*CRC_;
         HashGenerator		*hash_;
 #endif // #ifdef CMNSTRM_USE_CHECK_SUM
     };
 
+    // Memory stream readers, see BitStreamReaderT.cpp
+    template<>
+    ReturnCode BitStreamReaderT<RawIStream>::Init(const char *iBuffer, BitCount_t iBufferLength);
+
+    template<>
+    ReturnCode BitStreamReaderT<RawIStream>::Init(const unsigned char *iBuffer, BitCount_t iBufferLength);
+
+    template<>
+    ReturnCode BitStreamReaderT<RawIStream>::Init(const BitStreamReaderT<RawIStream> &bs2);
+
+    template<>
+    BitStreamReaderT<RawIStream> &BitStreamReaderT<RawIStream>::operator=(const BitStreamReaderT<RawIStream> &bs2);
+
+    template<>
+    BitStreamReaderT<RawIStream>::~BitStreamReaderT();
+
+    template<>
+    char *BitStreamReaderT<RawIStream>::buffer() const;
+
+    // Memory streams hand out the rest of their buffer as lookahead
+    template<>
+    size_t BitStreamReaderT<RawIStream>::fetch(void);
+
     template<typename StreamType>
     BitStreamReaderT<StreamType>::BitStreamReaderT()
     {
@@ -280,6 +406,8 @@ namespace CommonStream
         bufferLengthInBits_ = 0;
         stream_ = nullptr;
 
+        initLookahead();
+
 #ifdef CMNSTRM_USE_CHECK_SUM
         hash_ = nullptr;
         CRC_ = nullptr;
@@ -290,6 +418,281 @@ namespace CommonStream
         return OK;
     }
 
+    template<typename StreamType>
+    void BitStreamReaderT<StreamType>::initLookahead(void)
+    {
+        wordBuffer_ = 0;
+        wordBufferFill_ = 0;
+        lookaheadPtr_ = nullptr;
+        lookaheadEnd_ = nullptr;
+        lookaheadBase_ = nullptr;
+        lookaheadBasePos_ = 0;
+        blockBuffer_ = nullptr;
+        blockReadSize_ = 0;
+        lookaheadByte_ = 0;
+    }
+
+    /*
+     * Word buffer and block lookahead
+     */
+
+    // Drops all whole bytes buffered ahead of the read position, keeping the bits
+    // left over from a partially consumed byte. The stream position is not touched.
+
+    template<typename StreamType>
+    void BitStreamReaderT<StreamType>::dropLookahead(void)
+    {
+        wordBufferFill_ &= 7;
+        wordBuffer_ &= ~(~static_cast<uint64_t>(0) >> wordBufferFill_);
+
+        lookaheadPtr_ = nullptr;
+        lookaheadEnd_ = nullptr;
+        lookaheadBase_ = nullptr;
+    }
+
+    // Moves the read position to iPos if it lies within the current block, keeping
+    // the bits left over from a partially consumed byte. Returns false otherwise.
+
+    template<typename StreamType>
+    bool BitStreamReaderT<StreamType>::seekWithinLookahead(std::ios_base::streampos iPos)
+    {
+        if (lookaheadBase_ == nullptr)
+        {
+            return false;
+        }
+
+        std::streamoff offset = static_cast<std::streamoff>(iPos) - static_cast<std::streamoff>(lookaheadBasePos_);
+
+        if (offset < 0 || offset > static_cast<std::streamoff>(lookaheadEnd_ - lookaheadBase_))
+        {
+            return false;
+        }
+
+        wordBufferFill_ &= 7;
+        wordBuffer_ &= ~(~static_cast<uint64_t>(0) >> wordBufferFill_);
+        lookaheadPtr_ = lookaheadBase_ + offset;
+
+        return true;
+    }
+
+    // Takes the next bytes from the stream into the lookahead and returns how many were taken.
+    // Returns 0 when the stream has no more data, with the stream eof/fail state set by get().
+
+    template<typename StreamType>
+    size_t BitStreamReaderT<StreamType>::fetch(void)
+    {
+        if (blockReadSize_ > 0)
+        {
+            if (blockBuffer_ == nullptr)
+            {
+                blockBuffer_ = new(std::nothrow) uint8_t[blockReadSize_];
+            }
+
+            std::ios_base::streampos pos = stream_->tellg();
+
+            if (blockBuffer_ != nullptr && pos != std::ios_base::streampos(-1))
+            {
+                std::streamsize numRead = stream_->rdbuf()->sgetn(reinterpret_cast<char *>(blockBuffer_), blockReadSize_);
+
+                if (numRead > 0)
+                {
+                    lookaheadBase_ = blockBuffer_;
+                    lookaheadBasePos_ = pos;
+                    lookaheadPtr_ = blockBuffer_;
+                    lookaheadEnd_ = blockBuffer_ + numRead;
+
+                    return static_cast<size_t>(numRead);
+                }
+            }
+        }
+
+        // Unbuffered, or the block read came back empty: go through get() so
+        // that the stream reports end of data in the usual way.
+        //
+        lookaheadBase_ = nullptr;
+
+        char c;
+
+        stream_->get(c);
+        if (!stream_->good())
+        {
+            lookaheadPtr_ = nullptr;
+            lookaheadEnd_ = nullptr;
+            return 0;
+        }
+
+        lookaheadByte_ = static_cast<uint8_t>(c);
+        lookaheadPtr_ = &lookaheadByte_;
+        lookaheadEnd_ = lookaheadPtr_ + 1;
+
+        return 1;
+    }
+
+    // Moves bytes from the lookahead into the word buffer until it holds at least iNumBits bits
+    // (iNumBits <= 57). Bytes already in the lookahead are taken greedily, but the stream is only
+    // read when the word buffer would otherwise come up short.
+
+    template<typename StreamType>
+    ReturnCode BitStreamReaderT<StreamType>::fill(uint8_t iNumBits)
+    {
+        while (wordBufferFill_ <= 56)
+        {
+            size_t available = static_cast<size_t>(lookaheadEnd_ - lookaheadPtr_);
+
+            if (available == 0)
+            {
+                if (wordBufferFill_ >= iNumBits)
+                {
+                    break;
+                }
+
+                available = fetch();
+
+                if (available == 0)
+                {
+                    ReturnCode rc = status();
+                    return (rc != OK) ? rc : IO_EOF;
+                }
+            }
+
+            uint32_t numBytes = (64 - wordBufferFill_) >> 3;
+            const uint8_t *p = lookaheadPtr_;
+
+            if (available >= 8)
+            {
+                uint64_t word =
+                    (static_cast<uint64_t>(p[0]) << 56) | (static_cast<uint64_t>(p[1]) << 48) |
+                    (static_cast<uint64_t>(p[2]) << 40) | (static_cast<uint64_t>(p[3]) << 32) |
+                    (static_cast<uint64_t>(p[4]) << 24) | (static_cast<uint64_t>(p[5]) << 16) |
+                    (static_cast<uint64_t>(p[6]) << 8) | static_cast<uint64_t>(p[7]);
+
+                wordBuffer_ |= (word >> (64 - (numBytes << 3))) << (64 - wordBufferFill_ - (numBytes << 3));
+            }
+            else
+            {
+                if (numBytes > available)
+                {
+                    numBytes = static_cast<uint32_t>(available);
+                }
+
+                for (uint32_t i = 0; i < numBytes; i++)
+                {
+                    wordBuffer_ |= static_cast<uint64_t>(p[i]) << (56 - wordBufferFill_ - (i << 3));
+                }
+            }
+
+#ifdef CMNSTRM_USE_CHECK_SUM
+            if (hash_ && hash_->useHash())
+            {
+                hash_->accumulate(const_cast<uint8_t *>(p), numBytes);
+            }
+#endif // #ifdef CMNSTRM_USE_CHECK_SUM
+
+            lookaheadPtr_ += numBytes;
+            wordBufferFill_ += numBytes << 3;
+        }
+
+        return OK;
+    }
+
+    template<typename StreamType>
+    ReturnCode BitStreamReaderT<StreamType>::lookahead(uint64_t &oVal, uint8_t iNumBits)
+    {
+        oVal = 0;
+
+        if (iNumBits == 0)
+        {
+            return status();
+        }
+
+        uint64_t bits = 0;
+        uint32_t numBits = 0;
+
+        ReturnCode rc = lookahead(bits, numBits, iNumBits);
+
+        if (rc != OK)
+        {
+            return rc;
+        }
+
+        if (numBits < iNumBits)
+        {
+            return IO_EOF;
+        }
+
+        oVal = bits >> (64 - iNumBits);
+
+        return OK;
+    }
+
+    template<typename StreamType>
+    ReturnCode BitStreamReaderT<StreamType>::lookaheadFill(uint64_t &oBits, uint32_t &oNumBits, uint8_t iNumBits)
+    {
+        oBits = 0;
+        oNumBits = 0;
+
+        if (!good())
+        {
+            return status();
+        }
+
+        if (iNumBits > 57)
+        {
+            return PARAMS_BAD;
+        }
+
+        if (wordBufferFill_ < iNumBits)
+        {
+            fill(iNumBits);
+
+            if (wordBufferFill_ < iNumBits)
+            {
+                // Running into the end of the stream is not an error until the bits are read.
+                // Leave the stream and reader as good as they were; the bits fetched so far stay buffered.
+                //
+                stream_->clear();
+                error_ = OK;
+            }
+        }
+
+        oBits = wordBuffer_;
+        oNumBits = wordBufferFill_;
+
+        if (bitCount_ + oNumBits > bufferLengthInBits_)
+        {
+            oNumBits = static_cast<uint32_t>(bufferLengthInBits_ - bitCount_);
+        }
+
+        return OK;
+    }
+
+    template<typename StreamType>
+    ReturnCode BitStreamReaderT<StreamType>::setBlockReadSize(uint32_t iNumBytes)
+    {
+        releaseLookahead();
+
+        delete [] blockBuffer_;
+        blockBuffer_ = nullptr;
+        blockReadSize_ = iNumBytes;
+
+        return status();
+    }
+
+    template<typename StreamType>
+    ReturnCode BitStreamReaderT<StreamType>::releaseLookahead(void)
+    {
+        std::streamoff buffered = static_cast<std::streamoff>(lookaheadEnd_ - lookaheadPtr_) + static_cast<std::streamoff>(wordBufferFill_ >> 3);
+
+        dropLookahead();
+
+        if (buffered > 0)
+        {
+            stream_->seekg(-buffered, std::ios_base::cur);
+        }
+
+        return status();
+    }
+
     template<typename StreamType>
     ReturnCode BitStreamReaderT<StreamType>::sync(const uint8_t *iVal, uint8_t iNumBytes, const uint8_t *iMask)
     {
@@ -307,6 +710,10 @@ namespace CommonStream
             return status();
         }
 
+        // Scanning below goes directly to the stream
+        //
+        releaseLookahead();
+
         // Allocate enough memory to store our read data
         //
         uint8_t *currSyncBuf = new uint8_t[iNumBytes];
@@ -455,6 +862,10 @@ namespace CommonStream
             return status();
         }
 
+        // Scanning below goes directly to the stream
+        //
+        releaseLookahead();
+
         // Allocate enough memory to store our read data
         //
         uint8_t *currSyncBuf = new uint8_t[iNumBytes];
@@ -624,10 +1035,15 @@ namespace CommonStream
         BitStreamStateT<StreamType> state;
 
         state.streamState(stream_->rdstate());
-        state.streamPosition(stream_->tellg());
+        state.streamPosition(streamPosition());
 
-        state.bitBuffer(bitBuffer_);
-        state.bitBufferFill(bitBufferFill_);
+        // Only the bits of a partially consumed byte are part of the state,
+        // whole buffered bytes are re-read from the stream position.
+        //
+        uint32_t partialBits = wordBufferFill_ & 7;
+
+        state.bitBuffer(static_cast<uint8_t>(wordBuffer_ >> 56) & static_cast<uint8_t>(0xFF00 >> partialBits));
+        state.bitBufferFill(partialBits);
         state.bitCount(bitCount_);
         state.bufferLengthInBits(bufferLengthInBits_);
         state.error(error_);
@@ -642,10 +1058,15 @@ namespace CommonStream
     {
         stream_->clear();
         stream_->setstate(state.streamState());
-        stream_->seekg(state.streamPosition());
+
+        if (!seekWithinLookahead(state.streamPosition()))
+        {
+            dropLookahead();
+            stream_->seekg(state.streamPosition());
+        }
         
-        bitBuffer_ = state.bitBuffer();
-        bitBufferFill_ = state.bitBufferFill();
+        wordBuffer_ = static_cast<uint64_t>(state.bitBuffer()) << 56;
+        wordBufferFill_ = state.bitBufferFill();
         bitCount_ = state.bitCount();
         bufferLengthInBits_ = state.bufferLengthInBits();
         error_ = state.error();
@@ -661,8 +1082,9 @@ namespace CommonStream
         stream_->clear();
         stream_->seekg(0);
 
-        bitBuffer_ = 0;
-        bitBufferFill_ = 0;
+        dropLookahead();
+        wordBuffer_ = 0;
+        wordBufferFill_ = 0;
         bitCount_ = 0;
 
         error_ = OK;
@@ -695,45 +1117,95 @@ namespace CommonStream
             return IO_EOF;
         }
 
-        stream_->read((char *) oVal, iNumBytes);
-        if (stream_->good())
+        if (wordBufferFill_ & 7)
         {
-#ifdef CMNSTRM_USE_CHECK_SUM
-            if (hash_ && hash_->useHash())
+            // Unaligned byte reads go through the word buffer one byte at a time
+            //
+            for (uint32_t i = 0; i < iNumBytes; i++)
             {
-                hash_->accumulate(oVal, iNumBytes);
+                uint32_t tmp;
+
+                ReturnCode rc = read_unchecked(tmp, 8);
+                if (rc != OK)
+                {
+                    return rc;
+                }
+
+                oVal[i] = static_cast<uint8_t>(tmp);
             }
-#endif // #ifdef CMNSTRM_USE_CHECK_SUM
 
-            uint8_t *buf = oVal;
-            uint8_t *end = oVal + iNumBytes;
+            return status();
+        }
 
-            while (buf != end)
-            {
-                uint8_t tmp = *buf;
+        uint8_t *buf = oVal;
+        uint32_t bytesLeft = iNumBytes;
 
-                *buf = (tmp >> bitBufferFill_) | bitBuffer_;
+        // Whole bytes already in the word buffer come first, then the block lookahead
+        //
+        while (bytesLeft > 0 && wordBufferFill_ > 0)
+        {
+            *buf++ = static_cast<uint8_t>(wordBuffer_ >> 56);
+            wordBuffer_ <<= 8;
+            wordBufferFill_ -= 8;
+            --bytesLeft;
+        }
+
+        uint32_t numLookahead = static_cast<uint32_t>(lookaheadEnd_ - lookaheadPtr_);
 
-                bitBuffer_ = tmp << (8 - bitBufferFill_);
+        if (numLookahead > bytesLeft)
+        {
+            numLookahead = bytesLeft;
+        }
+
+        if (numLookahead > 0)
+        {
+            memcpy(buf, lookaheadPtr_, numLookahead);
 
 #ifdef CMNSTRM_USE_CHECK_SUM
-                if (CRC_ && CRC_->useCRC())
-                {
-                    CRC_->accumulate((uint32_t)*buf, 8);
-                }
+            if (hash_ && hash_->useHash())
+            {
+                hash_->accumulate(buf, numLookahead);
+            }
 #endif // #ifdef CMNSTRM_USE_CHECK_SUM
 
-                buf++;
-            }
+            lookaheadPtr_ += numLookahead;
+            buf += numLookahead;
+            bytesLeft -= numLookahead;
+        }
 
-            return status();
+        // The rest is read from the stream in one go, bypassing the lookahead
+        //
+        if (bytesLeft > 0)
+        {
+            dropLookahead();
 
+            stream_->read((char *) buf, bytesLeft);
+            if (!stream_->good())
+            {
+                return status();
+            }
+
+#ifdef CMNSTRM_USE_CHECK_SUM
+            if (hash_ && hash_->useHash())
+            {
+                hash_->accumulate(buf, bytesLeft);
+            }
+#endif // #ifdef CMNSTRM_USE_CHECK_SUM
         }
-        else
+
+        bitCount_ = totalBitCount;
+
+#ifdef CMNSTRM_USE_CHECK_SUM
+        if (CRC_ && CRC_->useCRC())
         {
-            return status();
+            for (uint32_t i = 0; i < iNumBytes; i++)
+            {
+                CRC_->accumulate((uint32_t)oVal[i], 8);
+            }
         }
+#endif // #ifdef CMNSTRM_USE_CHECK_SUM
 
+        return status();
     }
 
     template<typename StreamType>
@@ -779,46 +1251,11 @@ namespace CommonStream
             return IO_EOF;
         }
 
-        if (bitBufferFill_ == 0)
-        {
-            char c;
-
-            //stream_->get(c);
-            stream_->read(&c, 1);
-            if (stream_->good())
-            {
-                bitBuffer_ = (unsigned char) c;
-                bitBufferFill_ = 8;
-
-#ifdef CMNSTRM_USE_CHECK_SUM
-                if (hash_ && hash_->useHash())
-                {
-                    hash_->accumulate(&bitBuffer_, 1);
-                }
-#endif // #ifdef CMNSTRM_USE_CHECK_SUM
-
-            }
-            else
-            {
-                return status();
-            }
-        }
-
-        // Asserted: bitBufferFill_ > 0 => read bit
-
-        oVal = (bitBuffer_ >> 7) != 0;
-        bitBuffer_ <<= 1;
-        bitBufferFill_--;
-        bitCount_++;
-
-#ifdef CMNSTRM_USE_CHECK_SUM
-        if (CRC_ && CRC_->useCRC())
-        {
-            CRC_->accumulate((uint32_t)oVal, 1);
-        }
-#endif // #ifdef CMNSTRM_USE_CHECK_SUM
+        uint32_t tmp = 0;
+        ReturnCode rc = read_unchecked(tmp, 1);
+        oVal = (tmp != 0);
 
-        return status();
+        return rc;
     }
 
     template<typename StreamType>
@@ -987,47 +1424,32 @@ namespace CommonStream
             return IO_EOF;
         }
 
-        uint8_t currentBit = iNumBits;
-
-        while (currentBit > 0)
+        if (wordBufferFill_ < iNumBits)
         {
-            uint32_t rbits = (currentBit > bitBufferFill_) ? bitBufferFill_ : currentBit;
-            currentBit -= rbits;
+            ReturnCode rc = fill(iNumBits);
 
-            if (rbits > 0)
+            if (wordBufferFill_ < iNumBits)
             {
-                oVal = (oVal << rbits) | (bitBuffer_ >> (8 - rbits));
-                bitBuffer_ = bitBuffer_ << rbits;
-                bitBufferFill_ -= rbits;
-                bitCount_ += rbits;
-            }
-
-            if (currentBit > 0)
-            {
-                char c;
-
-                //stream_->read(&c, 1);
-                stream_->get(c);
-                if (stream_->good())
+                // Out of data, the remaining bits are consumed as for a short read
+                //
+                if (wordBufferFill_ > 0)
                 {
-                    bitBuffer_ = (unsigned char) c;
-                    bitBufferFill_ = 8;
+                    oVal = static_cast<uint32_t>(wordBuffer_ >> (64 - wordBufferFill_));
+                }
 
-#ifdef CMNSTRM_USE_CHECK_SUM
-                    if (hash_ && hash_->useHash())
-                    {
-                        hash_->accumulate(&bitBuffer_, 1);
-                    }
-#endif // #ifdef CMNSTRM_USE_CHECK_SUM
+                bitCount_ += wordBufferFill_;
+                wordBuffer_ = 0;
+                wordBufferFill_ = 0;
 
-                }
-                else
-                {
-                    return status();
-                }
+                return rc;
             }
         }
 
+        oVal = static_cast<uint32_t>(wordBuffer_ >> (64 - iNumBits));
+        wordBuffer_ <<= iNumBits;
+        wordBufferFill_ -= iNumBits;
+        bitCount_ += iNumBits;
+
 #ifdef CMNSTRM_USE_CHECK_SUM
         if (CRC_ && CRC_->useCRC())
         {
@@ -1111,7 +1533,7 @@ namespace CommonStream
                 return rc;
             }
             oVal = static_cast<uint64_t>(oVal32) << 32;
-            bitsRead = 32;
+            bitsRead = iNumBits - 32;
         }
         rc = read_unchecked(oVal32, iNumBits - bitsRead);
         if ( rc )
@@ -1405,11 +1827,11 @@ namespace CommonStream
             return status();
         }
 
-        uint8_t tmp;
+        uint32_t tmp;
 
-        if (bitBufferFill_)
+        if (wordBufferFill_ & 7)
         {
-            return read(tmp, bitBufferFill_);
+            return read_unchecked(tmp, wordBufferFill_ & 7);
         }
 
         return status();
@@ -1447,12 +1869,6 @@ namespace CommonStream
     }
 
 
-    template<typename StreamType>
-    ReturnCode BitStreamReaderT<StreamType>::skip(uint8_t iNumbits)
-    {
-        return skip(static_cast<BitCount_t>(iNumbits));
-    }
-
     template<typename StreamType>
     ReturnCode BitStreamReaderT<StreamType>::skipAligned(uint8_t iNumbytes)
     {
@@ -246,11 +246,6 @@ namespace CommonStream
         return *this;
     }
 
-    std::ios_base::iostate RawStream::rdstate() const
-    {
-        return state_;
-    }
-
     std::ios_base::iostate RawStream::setstate(std::ios_base::iostate st)
     {
         if ( (st & ~(eofbit_ | badbit_ | failbit_)) != 0  )
@@ -265,26 +260,6 @@ namespace CommonStream
         setstate(goodstate_);
     }
 
-    bool RawStream::good() const
-    {
-        return !state_;
-    }
-
-    bool RawStream::fail() const
-    {
-        return ((state_ & failbit_) != 0);
-    }
-
-    bool RawStream::eof() const
-    {
-        return ((state_ & eofbit_) != 0);
-    }
-
-    bool RawStream::bad() const
-    {
-        return (state_ & badbit_);
-    }
-
     BitCount_t RawStream::gcount() const
     {
         return gcount_;
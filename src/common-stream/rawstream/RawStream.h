@@ -60,13 +60,28 @@ namespace CommonStream
             return buffer_size_;
         }
 
-        std::ios_base::iostate rdstate() const;
+        std::ios_base::iostate rdstate() const
+        {
+            return state_;
+        }
         std::ios_base::iostate setstate(std::ios_base::iostate st);
         void clear();
-        bool good() const;
-        bool fail() const;
-        bool eof() const;
-        bool bad() const;
+        bool good() const
+        {
+            return !state_;
+        }
+        bool fail() const
+        {
+            return ((state_ & failbit_) != 0);
+        }
+        bool eof() const
+        {
+            return ((state_ & eofbit_) != 0);
+        }
+        bool bad() const
+        {
+            return ((state_ & badbit_) != 0);
+        }
         void reset();
         BitCount_t gcount() const;
         BitCount_t tell() const;
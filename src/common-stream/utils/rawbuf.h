@@ -43,11 +43,53 @@ struct OStreamBufWrapper : public std::basic_streambuf<char_type, std::char_trai
 template <typename char_type>
 struct IStreamBufWrapper : public std::basic_streambuf<char_type, std::char_traits<char_type> >
 {
+    typedef std::basic_streambuf<char_type, std::char_traits<char_type> > base_type;
+    typedef typename base_type::pos_type pos_type;
+    typedef typename base_type::off_type off_type;
+
     IStreamBufWrapper(char_type* buffer, std::streamsize bufferLength)
     {
-        // set the "put" pointer the start of the buffer and record its length.
+        // set the "get" pointer the start of the buffer and record its length.
         this->setg(buffer, buffer, buffer + bufferLength);
     }
+
+protected:
+
+    // Seeking within the buffer, so that tellg()/seekg() work on streams reading from it.
+    virtual pos_type seekoff(off_type offset, std::ios_base::seekdir way, std::ios_base::openmode which)
+    {
+        if (!(which & std::ios_base::in))
+        {
+            return pos_type(off_type(-1));
+        }
+
+        off_type base = 0;
+
+        if (way == std::ios_base::cur)
+        {
+            base = static_cast<off_type>(this->gptr() - this->eback());
+        }
+        else if (way == std::ios_base::end)
+        {
+            base = static_cast<off_type>(this->egptr() - this->eback());
+        }
+
+        off_type target = base + offset;
+
+        if ((target < 0) || (target > static_cast<off_type>(this->egptr() - this->eback())))
+        {
+            return pos_type(off_type(-1));
+        }
+
+        this->setg(this->eback(), this->eback() + target, this->egptr());
+
+        return pos_type(target);
+    }
+
+    virtual pos_type seekpos(pos_type pos, std::ios_base::openmode which)
+    {
+        return seekoff(off_type(pos), std::ios_base::beg, which);
+    }
 };
 
 }  // namespace CommonStream
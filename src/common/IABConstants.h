@@ -34,6 +34,17 @@ THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 
 #include "IABDataTypes.h"
 
+/**
+ * Storage class of per thread state, such as the current IABFrameArena, so that frames can be
+ * parsed on several threads. (__thread, not thread_local, keeps pre-C++11 GCC builds working.)
+ *
+ */
+#if defined(_MSC_VER)
+#define IAB_THREAD_LOCAL __declspec(thread)
+#else
+#define IAB_THREAD_LOCAL __thread
+#endif
+
 namespace SMPTE
 {
 namespace ImmersiveAudioBitstream
@@ -112,6 +123,12 @@ namespace ImmersiveAudioBitstream
      */
 	static const uint32_t kIABMaxFrameSampleCount = 4000;
     
+    /**
+     * Size of the blocks read from the input stream when parsing IA frames
+     *
+     */
+    static const uint32_t kIABFrameReaderBlockSize = 32768;
+    
     /**
      * Highest positive value for 32-bit signed integer (= 2^31 - 1), casted to float
      *
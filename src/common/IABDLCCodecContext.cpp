@@ -0,0 +1,116 @@
+/* Copyright (c) 2020 Xperi Corporation (and its subsidiaries). All rights reserved.
+ 
+Permission is hereby granted, free of charge, to any person obtaining
+a copy of this software and associated documentation files (the "Software"),
+to deal in the Software without restriction, including without limitation
+the rights to use, copy, modify, merge, publish, distribute, sublicense,
+and/or sell copies of the Software, and to permit persons to whom the
+Software is furnished to do so, subject to the following conditions:
+ 
+The above copyright notice and this permission notice shall be included
+in all copies or substantial portions of the Software.
+ 
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ 
+IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT
+OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR
+THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#include "IABDLCCodecContext.h"
+#include "IABConstants.h"
+
+#ifdef USE_MDA_NULLPTR
+/* support lack of nullptr on older C++ compilers such as g++-4.4.7 */
+#include "nullptrOldCompilers.h"
+#endif
+
+namespace SMPTE
+{
+namespace ImmersiveAudioBitstream
+{
+	// Current context, per thread and initialized with 0 as for IABFrameArena
+	static IAB_THREAD_LOCAL IABDLCCodecContext* currentDLCCodecContext = 0;
+
+	// ****************************************************************************
+	// IABDLCCodecContext class implementation
+	// ****************************************************************************
+
+	// Constructor implementation
+	IABDLCCodecContext::IABDLCCodecContext()
+	{
+		encoder48k_ = nullptr;
+		encoderFrameRate_ = kIABFrameRate_BoundReserved;
+	}
+
+	// Destructor implementation
+	IABDLCCodecContext::~IABDLCCodecContext()
+	{
+		delete encoder48k_;
+	}
+
+	// IABDLCCodecContext::GetDecoder() implementation
+	dlc::FullDecoder& IABDLCCodecContext::GetDecoder()
+	{
+		return decoder_;
+	}
+
+	// IABDLCCodecContext::GetEncoder48k() implementation
+	dlc::SimpleEncoder* IABDLCCodecContext::GetEncoder48k(IABFrameRateType iFrameRate)
+	{
+		if (!encoder48k_)
+		{
+			encoder48k_ = new dlc::SimpleEncoder();
+		}
+
+		// Set up again only when the frame rate changes, the 48 kHz encoder holds no state between frames
+		if (iFrameRate != encoderFrameRate_)
+		{
+			encoderFrameRate_ = kIABFrameRate_BoundReserved;
+
+			if (encoder48k_->setup(dlc::eSampleRate_48000, static_cast<dlc::FrameRate>(iFrameRate))
+				!= dlc::SimpleEncoder::StatusCode_OK)
+			{
+				return nullptr;
+			}
+
+			encoderFrameRate_ = iFrameRate;
+		}
+
+		return encoder48k_;
+	}
+
+	// IABDLCCodecContext::GetSampleBuffer() implementation
+	int32_t* IABDLCCodecContext::GetSampleBuffer(uint32_t iSampleCount)
+	{
+		if (samples_.size() < iSampleCount)
+		{
+			samples_.resize(iSampleCount);
+		}
+
+		return &samples_[0];
+	}
+
+	// IABDLCCodecContext::GetCurrent() implementation
+	IABDLCCodecContext* IABDLCCodecContext::GetCurrent()
+	{
+		return currentDLCCodecContext;
+	}
+
+	// IABDLCCodecContext::Scope implementation
+	IABDLCCodecContext::Scope::Scope(IABDLCCodecContext* iContext)
+	{
+		previous_ = currentDLCCodecContext;
+		currentDLCCodecContext = iContext;
+	}
+
+	IABDLCCodecContext::Scope::~Scope()
+	{
+		currentDLCCodecContext = previous_;
+	}
+
+} // namespace ImmersiveAudioBitstream
+} // namespace SMPTE
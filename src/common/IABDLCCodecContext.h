@@ -0,0 +1,111 @@
+/* Copyright (c) 2020 Xperi Corporation (and its subsidiaries). All rights reserved.
+ 
+Permission is hereby granted, free of charge, to any person obtaining
+a copy of this software and associated documentation files (the "Software"),
+to deal in the Software without restriction, including without limitation
+the rights to use, copy, modify, merge, publish, distribute, sublicense,
+and/or sell copies of the Software, and to permit persons to whom the
+Software is furnished to do so, subject to the following conditions:
+ 
+The above copyright notice and this permission notice shall be included
+in all copies or substantial portions of the Software.
+ 
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ 
+IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT
+OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR
+THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+/**
+* Header file for the DLC codec context shared by IAB DLC elements.
+*
+* @file
+*/
+
+#ifndef __IABDLCCODECCONTEXT_H__
+#define	__IABDLCCODECCONTEXT_H__
+
+#include <vector>
+
+#include "IABDataTypes.h"
+#include "DLCSimpleEncoder.h"
+#include "DLCFullDecoder.h"
+
+namespace SMPTE
+{
+namespace ImmersiveAudioBitstream
+{
+	/**
+	* @brief DLC codec engines and scratch buffers, borrowed by IABAudioDataDLC elements.
+	*
+	* A frame may carry many DLC elements. Instead of each element owning an encoder, a decoder and
+	* a decoding buffer, elements borrow them from the current context for the duration of
+	* EncodeMonoPCMToDLC() or DecodeDLCToMonoPCM(). The parser owns one context, selected while it
+	* decodes audio assets. Without a current context, an element or a frame decoding all its audio
+	* creates its own context on first use, and keeps it for the next calls.
+	*
+	* The 96 kHz encoder filters across frames, so its state stays with each element.
+	*
+	*/
+	class IABDLCCodecContext
+	{
+	public:
+
+		// Constructor. The encoder and buffer are allocated on first use.
+		IABDLCCodecContext();
+
+		// Destructor
+		~IABDLCCodecContext();
+
+		// Get decoder. Its predictor coefficient cache is shared by all elements decoded with this context.
+		dlc::FullDecoder& GetDecoder();
+
+		// Get encoder set up for 48 kHz at iFrameRate, nullptr if DLC does not support the frame rate
+		dlc::SimpleEncoder* GetEncoder48k(IABFrameRateType iFrameRate);
+
+		// Get scratch buffer of at least iSampleCount samples, valid until the next call
+		int32_t* GetSampleBuffer(uint32_t iSampleCount);
+
+		// Context that DLC elements borrow from on the calling thread, nullptr if none is selected
+		static IABDLCCodecContext* GetCurrent();
+
+		/**
+		* Selects the current context for the calling thread, for the lifetime of the scope.
+		* The previous context is restored on exit.
+		*
+		*/
+		class Scope
+		{
+		public:
+			Scope(IABDLCCodecContext* iContext);
+			~Scope();
+
+		private:
+			IABDLCCodecContext* previous_;
+		};
+
+	private:
+
+		// Not copyable
+		IABDLCCodecContext(const IABDLCCodecContext&);
+		IABDLCCodecContext& operator=(const IABDLCCodecContext&);
+
+		// Decoder shared by all elements
+		dlc::FullDecoder decoder_;
+
+		// 48 kHz encoder, nullptr until first use, and frame rate it is set up for
+		dlc::SimpleEncoder* encoder48k_;
+		IABFrameRateType encoderFrameRate_;
+
+		// Scratch buffer for decoding, see GetSampleBuffer()
+		std::vector<int32_t> samples_;
+	};
+
+} // namespace ImmersiveAudioBitstream
+} // namespace SMPTE
+
+#endif // __IABDLCCODECCONTEXT_H__
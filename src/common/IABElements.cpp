@@ -21,6 +21,13 @@ THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 */
 
 #include <set>
+#include <algorithm>
+#include <climits>
+#include <cstring>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
 
 /* Implementation of IABElements class functions functions */
 
@@ -28,6 +35,7 @@ THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #include "IABDataTypes.h"
 #include "IABUtilities.h"
 #include "BitStreamIOHelpers.h"
+#include "RawIStream.h"
 #include "opbacksbuf.h"
 
 // To support validation and event handler
@@ -60,6 +68,12 @@ namespace ImmersiveAudioBitstream
         return iabFrame;
     }
 
+    // Create IABFrame instance parsing from a frame data buffer
+    IABFrameInterface* IABFrameInterface::Create(const char* iFrameBuffer, uint32_t iBufferSize)
+    {
+		return new IABFrame(iFrameBuffer, iBufferSize);
+    }
+
     void IABFrameInterface::Delete(IABFrameInterface* iInstance)
     {
         delete iInstance;
@@ -226,13 +240,289 @@ namespace ImmersiveAudioBitstream
 	// IABContainerSubFrame class implementation
 	// ****************************************************************************
 
+	// ****************************************************************************
+	// IABSerializeBuffer implementation
+	// ****************************************************************************
+
+	const uint64_t IABSerializeBuffer::kInitialSize;
+
+	// Constructor implementation
+	IABSerializeBuffer::IABSerializeBuffer() :
+		stream_(this),
+		writer_(stream_),
+		attached_(false)
+	{
+	}
+
+	// IABSerializeBuffer::GetWriter() implementation
+	StreamWriter& IABSerializeBuffer::GetWriter()
+	{
+		return writer_;
+	}
+
+	// IABSerializeBuffer::WriteBytes() implementation
+	void IABSerializeBuffer::WriteBytes(const uint8_t* iData, uint32_t iSize)
+	{
+		if ((writer_.getBitCount() % 8) == 0)
+		{
+			sputn(reinterpret_cast<const char*>(iData), static_cast<std::streamsize>(iSize));
+			writer_.IncrementBitCount(static_cast<uint64_t>(iSize) * 8);
+		}
+		else
+		{
+			for (uint32_t i = 0; i < iSize; i++)
+			{
+				writer_.write(iData[i], 8);
+			}
+		}
+	}
+
+	// IABSerializeBuffer::GetData() implementation
+	const char* IABSerializeBuffer::GetData() const
+	{
+		return pbase();
+	}
+
+	// IABSerializeBuffer::GetSize() implementation
+	uint64_t IABSerializeBuffer::GetSize() const
+	{
+		return static_cast<uint64_t>(pptr() - pbase());
+	}
+
+	// IABSerializeBuffer::Clear() implementation
+	void IABSerializeBuffer::Clear()
+	{
+		writer_.align();
+		Truncate(0);
+	}
+
+	// IABSerializeBuffer::Attach() implementation
+	void IABSerializeBuffer::Attach(char* iData, uint64_t iCapacity)
+	{
+		writer_.align();
+		setp(iData, iData + iCapacity);
+		attached_ = true;
+	}
+
+	// IABSerializeBuffer::IsAttached() implementation
+	bool IABSerializeBuffer::IsAttached() const
+	{
+		return attached_;
+	}
+
+	// IABSerializeBuffer::Detach() implementation
+	void IABSerializeBuffer::Detach()
+	{
+		writer_.align();
+		attached_ = false;
+
+		if (storage_.empty())
+		{
+			setp(nullptr, nullptr);
+		}
+		else
+		{
+			setp(&storage_[0], &storage_[0] + storage_.size());
+		}
+	}
+
+	// IABSerializeBuffer::Truncate() implementation
+	void IABSerializeBuffer::Truncate(uint64_t iSize)
+	{
+		if (iSize < GetSize())
+		{
+			SetSize(iSize);
+		}
+	}
+
+	// IABSerializeBuffer::WriteBytesAt() implementation
+	void IABSerializeBuffer::WriteBytesAt(uint64_t iPosition, const uint8_t* iData, uint32_t iSize)
+	{
+		memcpy(pbase() + iPosition, iData, iSize);
+	}
+
+	// IABSerializeBuffer::ResizeBytes() implementation
+	void IABSerializeBuffer::ResizeBytes(uint64_t iPosition, uint32_t iSize, uint32_t iNewSize)
+	{
+		uint64_t size = GetSize();
+		uint64_t newSize = size - iSize + iNewSize;
+
+		if (newSize > static_cast<uint64_t>(epptr() - pbase()))
+		{
+			Reserve(std::max<uint64_t>(2 * static_cast<uint64_t>(epptr() - pbase()), newSize));
+		}
+
+		char* data = pbase();
+		uint64_t tailPosition = iPosition + iSize;
+
+		memmove(data + iPosition + iNewSize, data + tailPosition, static_cast<size_t>(size - tailPosition));
+		SetSize(newSize);
+	}
+
+	// IABSerializeBuffer::Reserve() implementation
+	void IABSerializeBuffer::Reserve(uint64_t iSize)
+	{
+		if (iSize <= static_cast<uint64_t>(epptr() - pbase()))
+		{
+			return;
+		}
+
+		uint64_t size = GetSize();
+
+		if (attached_)
+		{
+			// Caller memory is full, move data to own storage
+			if (iSize > storage_.size())
+			{
+				storage_.resize(static_cast<size_t>(iSize));
+			}
+
+			if (size > 0)
+			{
+				memcpy(&storage_[0], pbase(), static_cast<size_t>(size));
+			}
+
+			attached_ = false;
+		}
+		else
+		{
+			storage_.resize(static_cast<size_t>(iSize));
+		}
+
+		setp(&storage_[0], &storage_[0] + storage_.size());
+		SetSize(size);
+	}
+
+	// IABSerializeBuffer::SetSize() implementation
+	void IABSerializeBuffer::SetSize(uint64_t iSize)
+	{
+		setp(pbase(), epptr());
+
+		// pbump() takes an int
+		while (iSize > static_cast<uint64_t>(INT_MAX))
+		{
+			pbump(INT_MAX);
+			iSize -= static_cast<uint64_t>(INT_MAX);
+		}
+
+		pbump(static_cast<int>(iSize));
+	}
+
+	// IABSerializeBuffer::overflow() implementation
+	IABSerializeBuffer::int_type IABSerializeBuffer::overflow(int_type iChar)
+	{
+		if (traits_type::eq_int_type(iChar, traits_type::eof()))
+		{
+			return traits_type::not_eof(iChar);
+		}
+
+		Reserve(std::max<uint64_t>(2 * static_cast<uint64_t>(epptr() - pbase()), kInitialSize));
+
+		*pptr() = traits_type::to_char_type(iChar);
+		pbump(1);
+
+		return iChar;
+	}
+
+	// IABSerializeBuffer::xsputn() implementation
+	std::streamsize IABSerializeBuffer::xsputn(const char* iData, std::streamsize iCount)
+	{
+		if (iCount > epptr() - pptr())
+		{
+			Reserve(std::max<uint64_t>(2 * static_cast<uint64_t>(epptr() - pbase()), GetSize() + static_cast<uint64_t>(iCount)));
+		}
+
+		memcpy(pptr(), iData, static_cast<size_t>(iCount));
+		SetSize(GetSize() + static_cast<uint64_t>(iCount));
+
+		return iCount;
+	}
+
+	// IABSerializeBuffer::seekoff() implementation
+	IABSerializeBuffer::pos_type IABSerializeBuffer::seekoff(off_type iOffset, std::ios_base::seekdir iDirection, std::ios_base::openmode iMode)
+	{
+		// Only reports the write position, for tellp(). Data is only ever appended.
+		if ((iOffset != 0) || (iDirection != std::ios_base::cur) || !(iMode & std::ios_base::out))
+		{
+			return pos_type(off_type(-1));
+		}
+
+		return pos_type(static_cast<off_type>(GetSize()));
+	}
+
+	// Is any of iElements allocated from a frame arena? Their ownership cannot be released to the caller,
+	// see IABFrameArenaObject.
+	static bool HasArenaAllocatedElement(const std::vector<IABElement*>& iElements)
+	{
+		for (std::vector<IABElement*>::const_iterator iter = iElements.begin(); iter != iElements.end(); iter++)
+		{
+			if (IABFrameArenaObject::IsArenaAllocated(dynamic_cast<const void*>(*iter)))
+			{
+				return true;
+			}
+		}
+
+		return false;
+	}
+
+	// Plex(8) coding of iValue into oField, of up to 7 bytes. Returns the coded size in bytes.
+	static uint32_t PackPlex8(uint32_t iValue, uint8_t* oField)
+	{
+		if (iValue < 0xFF)
+		{
+			oField[0] = static_cast<uint8_t>(iValue);
+			return 1;
+		}
+
+		oField[0] = 0xFF;
+
+		if (iValue < 0xFFFF)
+		{
+			oField[1] = static_cast<uint8_t>(iValue >> 8);
+			oField[2] = static_cast<uint8_t>(iValue);
+			return 3;
+		}
+
+		oField[1] = 0xFF;
+		oField[2] = 0xFF;
+		oField[3] = static_cast<uint8_t>(iValue >> 24);
+		oField[4] = static_cast<uint8_t>(iValue >> 16);
+		oField[5] = static_cast<uint8_t>(iValue >> 8);
+		oField[6] = static_cast<uint8_t>(iValue);
+		return 7;
+	}
+
+	// BorrowBytes() implementation
+	bool BorrowBytes(StreamReader& /* streamReader */, uint32_t /* iNumBytes */, const uint8_t*& oBytes)
+	{
+		// Stream data is only read
+		oBytes = nullptr;
+		return false;
+	}
+
+	bool BorrowBytes(BufferReader& streamReader, uint32_t iNumBytes, const uint8_t*& oBytes)
+	{
+		oBytes = nullptr;
+
+		std::ios_base::streampos currentPosition = streamReader.streamPosition();
+
+		if ((nullptr == streamReader.buffer()) ||
+			(static_cast<uint64_t>(currentPosition) + iNumBytes > static_cast<uint64_t>(streamReader.buffer_size())))
+		{
+			return false;
+		}
+
+		oBytes = reinterpret_cast<const uint8_t*>(streamReader.buffer()) + static_cast<std::streamoff>(currentPosition);
+		streamReader.streamPosition(currentPosition + static_cast<std::streamoff>(iNumBytes));
+
+		return true;
+	}
+
 	// Constructor implementation
 	IABContainerSubFrame::IABContainerSubFrame(IABContainerSubFrameTagType iSubFrameTag) :
 		subframeTag_(iSubFrameTag),
 		subframeLength_(0),
-		subframePayload_(nullptr),
-		containerHeadWriter_(containerHeadBuffer_),
-		containerHeadBuffer_(std::stringstream::in | std::stringstream::out | std::stringstream::binary)
+		subframePayload_(nullptr)
 	{
 	}
 
@@ -269,30 +559,20 @@ namespace ImmersiveAudioBitstream
 	}
 
 	// IABIASubFrame::Serialize() implementation
-	iabError IABIASubFrame::Serialize(std::ostream &outStream)
+	iabError IABIASubFrame::Serialize(StreamWriter& streamWriter)
 	{
-		// Set up writer and buffer
-		containerHeadWriter_.align();										// reset writer byte alignment
-		containerHeadBuffer_.seekp(0, std::ios::beg);						// reset internal payload buffer
-		containerHeadBuffer_.clear();
-
 		// Writing tag and length
-		containerHeadWriter_.write(static_cast<uint8_t>(subframeTag_), 8);						// Pack IAFrame tag
-		containerHeadWriter_.write(static_cast<uint32_t>(subframeLength_), 32);					// Pack IAFrame length (assuming length has been properly updated!)
+		streamWriter.write(static_cast<uint8_t>(subframeTag_), 8);						// Pack IAFrame tag
+		streamWriter.write(static_cast<uint32_t>(subframeLength_), 32);					// Pack IAFrame length (assuming length has been properly updated!)
 
 		// Not packing IAFrame payload (Value), as this is used by IABFrame as a wrapper only.
-		// 
-		// Output ...
-		outStream << containerHeadBuffer_.rdbuf();
-
-		// Clear stream contents after output
-		containerHeadBuffer_.str("");
 
 		return kIABNoError;
 	}
 
 	// IABIASubFrame::DeSerialize() implementation
-	iabError IABIASubFrame::DeSerialize(StreamReader& streamReader)
+	template<typename ReaderType>
+	iabError IABIASubFrame::DeSerializeElement(ReaderType& streamReader)
 	{
 		uint8_t parsedTag = 0;
         CommonStream::ReturnCode rCode = OK;
@@ -350,6 +630,16 @@ namespace ImmersiveAudioBitstream
         }
 	}
 
+	iabError IABIASubFrame::DeSerialize(StreamReader& streamReader)
+	{
+		return DeSerializeElement(streamReader);
+	}
+
+	iabError IABIASubFrame::DeSerialize(BufferReader& streamReader)
+	{
+		return DeSerializeElement(streamReader);
+	}
+
 	// ****************************************************************************
 	// IABPreamble class implementation
 	// ****************************************************************************
@@ -358,11 +648,22 @@ namespace ImmersiveAudioBitstream
 	IABPreamble::IABPreamble() :
 		IABContainerSubFrame(kIABContainerSubFrameTag_Preamble)
 	{
+		borrowedPayload_ = nullptr;
+		skipPayload_ = false;
+		borrowPayload_ = false;
 	}
 
 	// IABPreamble::GetPreamblePayload() implementation
-	void IABPreamble::GetPreamblePayload(uint8_t* &oPreamblePayload, IABSubframeLengthType &oLength) const
+	void IABPreamble::GetPreamblePayload(uint8_t* &oPreamblePayload, IABSubframeLengthType &oLength)
 	{
+		// Payload borrowed from the parsed buffer, make a copy of it on first request
+		if ((nullptr == subframePayload_) && (nullptr != borrowedPayload_))
+		{
+			subframePayload_ = new uint8_t[subframeLength_];
+			memcpy(subframePayload_, borrowedPayload_, subframeLength_);
+			borrowedPayload_ = nullptr;
+		}
+
 		oPreamblePayload = subframePayload_;
 		oLength = subframeLength_;
 	}
@@ -377,55 +678,55 @@ namespace ImmersiveAudioBitstream
 
 		subframePayload_ = iPreamblePayload;
 		subframeLength_ = iLength;
+		borrowedPayload_ = nullptr;
 		return kIABNoError;
 	}
 
-	// IABPreamble::Serialize() implementation
-	iabError IABPreamble::Serialize(std::ostream &outStream)
+	// IABPreamble::SetPayloadParsing() implementation
+	void IABPreamble::SetPayloadParsing(bool iSkipPayload, bool iBorrowPayload)
 	{
-		// Set up writer and buffer
-		containerHeadWriter_.align();										// reset writer byte alignment
-		containerHeadBuffer_.seekp(0, std::ios::beg);						// reset internal payload buffer
-		containerHeadBuffer_.clear();
+		skipPayload_ = iSkipPayload;
+		borrowPayload_ = iBorrowPayload;
+	}
 
-		// Writing tag and length
-		containerHeadWriter_.write(static_cast<uint8_t>(subframeTag_), 8);						// Pack IAFrame tag
-		containerHeadWriter_.write(static_cast<uint32_t>(subframeLength_), 32);					// Pack IAFrame length (assuming length has been properly updated!)
+	// IABPreamble::Serialize() implementation
+	iabError IABPreamble::Serialize(StreamWriter& streamWriter)
+	{
+		const uint8_t* payload = (subframePayload_ != nullptr) ? subframePayload_ : borrowedPayload_;
 
-																								// pack payload if the following are satisfied
-		if ((subframePayload_ != nullptr) && (subframeLength_ != 0))
+		// report error for this combination, before writing anything
+		if ((payload == nullptr) && (subframeLength_ != 0))
 		{
-			containerHeadWriter_.write(static_cast<const uint8_t*>(subframePayload_), subframeLength_);
-		}
-		else if ((subframePayload_ == nullptr) && (subframeLength_ != 0))	// report error for this combination
-		{
-			// Clear stream contents after output
-			containerHeadBuffer_.str("");
-
 			return kIABGeneralError;
 		}
-		else;
 
-		// Output ...
-		outStream << containerHeadBuffer_.rdbuf();
+		// Writing tag and length
+		streamWriter.write(static_cast<uint8_t>(subframeTag_), 8);						// Pack IAFrame tag
+		streamWriter.write(static_cast<uint32_t>(subframeLength_), 32);					// Pack IAFrame length (assuming length has been properly updated!)
 
-		// Clear stream contents after output
-		containerHeadBuffer_.str("");
+		// pack payload if present
+		if ((payload != nullptr) && (subframeLength_ != 0))
+		{
+			streamWriter.write(payload, subframeLength_);
+		}
 
 		return kIABNoError;
 	}
 
 	// IABPreamble::DeSerialize() implementation
-	iabError IABPreamble::DeSerialize(StreamReader& streamReader)
+	template<typename ReaderType>
+	iabError IABPreamble::DeSerializeElement(ReaderType& streamReader)
 	{
         uint8_t parsedTag = 0;
+        uint64_t peekedTag = 0;
         CommonStream::ReturnCode rCode = OK;
         
 		// Expect input stream position to be at beginning of preamble subframe.
 		// If not, parsed tag will be incorrect, and error will be reported.
 	
-		// Peek tag
-        rCode = streamReader.peek(parsedTag);
+		// Peek tag, from the reader lookahead
+        rCode = streamReader.lookahead(peekedTag, 8);
+        parsedTag = static_cast<uint8_t>(peekedTag);
         
         if (OK == rCode)
         {
@@ -441,17 +742,29 @@ namespace ImmersiveAudioBitstream
                 
                 if (OK == rCode)
                 {
+					// Drop any existent payload
+					SetPreamblePayload(nullptr, subframeLength_);
+
                     if (subframeLength_ > 0)
                     {
-						if (subframePayload_)
-						{
-							delete[] subframePayload_;							// Delete any existent payload
-						}
-
-						subframePayload_ = new uint8_t[subframeLength_];
-                        memset(subframePayload_, 0, subframeLength_);
+                        if (skipPayload_)
+                        {
+                            // Check that the payload is complete by reading its last byte, which leaves
+                            // the reader past the payload
+                            uint8_t lastByte = 0;
+                            streamReader.streamPosition(streamReader.streamPosition() + static_cast<std::streamoff>(subframeLength_ - 1));
+                            rCode = streamReader.read(lastByte);
+                        }
+                        else if (borrowPayload_ && BorrowBytes(streamReader, subframeLength_, borrowedPayload_))
+                        {
+                            rCode = OK;
+                        }
+                        else
+                        {
+                            subframePayload_ = new uint8_t[subframeLength_];
+                            rCode = streamReader.readAligned(subframePayload_, subframeLength_);
+                        }
                         
-                        rCode = streamReader.readAligned(subframePayload_, subframeLength_);
                         if (OK == rCode)
                         {
                             // No error
@@ -464,13 +777,8 @@ namespace ImmersiveAudioBitstream
             }
             else
             {
-                // Preamble not present
-                subframeLength_ = 0;
-				if (subframePayload_)
-				{
-					delete[] subframePayload_;							// Delete any existent payload
-				}
-				subframePayload_ = nullptr;
+                // Preamble not present, delete any existent payload
+				SetPreamblePayload(nullptr, 0);
                 return kIABParserMissingPreambleError;
             }
         }
@@ -494,6 +802,16 @@ namespace ImmersiveAudioBitstream
         }
 	}
 
+	iabError IABPreamble::DeSerialize(StreamReader& streamReader)
+	{
+		return DeSerializeElement(streamReader);
+	}
+
+	iabError IABPreamble::DeSerialize(BufferReader& streamReader)
+	{
+		return DeSerializeElement(streamReader);
+	}
+
 	// ****************************************************************************
 	// IABElement class implementation
 	// ****************************************************************************
@@ -503,10 +821,6 @@ namespace ImmersiveAudioBitstream
 		elementID_(iElementID),
 		elementSize_(0),
 		packingEnable_(1),
-		elementHeadWriter_(elementHeadBuffer_),
-		elementHeadBuffer_(std::stringstream::in | std::stringstream::out | std::stringstream::binary),
-		elementPayloadWriter_(elementPayloadBuffer_),
-		elementPayloadBuffer_(std::stringstream::in | std::stringstream::out | std::stringstream::binary),
 		elementReader_(nullptr)
 	{
 	}
@@ -518,6 +832,13 @@ namespace ImmersiveAudioBitstream
 		elementReader_ = nullptr;
 	}
 
+	// IABElement::ResetForReuse() implementation
+	void IABElement::ResetForReuse()
+	{
+		elementSize_ = 0;
+		packingEnable_ = 1;
+	}
+
 	// IABElement::GetElementID() implementation
 	void IABElement::GetElementID(IABElementIDType &oElementID) const
     {
@@ -555,18 +876,75 @@ namespace ImmersiveAudioBitstream
 		return (packingEnable_ != 0);
 	}
 
-	// IABElement::SerializeHead() implementation
-	iabError IABElement::SerializeHead()
+	// IABElement::Serialize() implementation
+	iabError IABElement::Serialize(std::ostream &outStream)
 	{
-		// Calling method for writing Plex encoded fields.
-		write(elementHeadWriter_, Plex<8>(elementID_));
-		write(elementHeadWriter_, Plex<8>(static_cast<uint32_t>(elementSize_)));
+		// Check if "this" element is included in packing. If not, simply return with no further processing
+		if (!IsIncludedForPacking())
+		{
+			return kIABNoError;
+		}
+
+		IABSerializeBuffer serializeBuffer;
+		iabError errorCode = SerializeElement(serializeBuffer);
+
+		if (errorCode != kIABNoError)
+		{
+			return errorCode;
+		}
+
+		outStream.write(serializeBuffer.GetData(), static_cast<std::streamsize>(serializeBuffer.GetSize()));
+
+		return kIABNoError;
+	}
+
+	// IABElement::SerializeElement() implementation
+	iabError IABElement::SerializeElement(IABSerializeBuffer& ioBuffer)
+	{
+		StreamWriter& streamWriter = ioBuffer.GetWriter();
+
+		// Element starts on a byte boundary
+		streamWriter.align();
+		uint64_t elementPosition = ioBuffer.GetSize();
+
+		// Element ID code and size are Plex(8) coded. The size is only known once the payload is
+		// written, leave it a slot as wide as the size from the last parsing or packing needs.
+		uint8_t sizeField[7];
+		uint32_t sizeSlot = PackPlex8(static_cast<uint32_t>(elementSize_), sizeField);
+
+		write(streamWriter, Plex<8>(elementID_));
+		uint64_t sizePosition = ioBuffer.GetSize();
+		ioBuffer.WriteBytes(sizeField, sizeSlot);
+
+		// Payload, written in place
+		uint64_t payloadPosition = ioBuffer.GetSize();
+		iabError errorCode = SerializePayload(ioBuffer);
+		streamWriter.align();
+
+		if (errorCode != kIABNoError)
+		{
+			// Leave nothing of a partly serialized element
+			ioBuffer.Truncate(elementPosition);
+			return errorCode;
+		}
+
+		// Element size is now known. The payload only moves if its size field is not as wide as the slot.
+		SetElementSize(static_cast<IABElementSizeType>(ioBuffer.GetSize() - payloadPosition));
+		uint32_t sizeFieldSize = PackPlex8(static_cast<uint32_t>(elementSize_), sizeField);
+
+		if (sizeFieldSize != sizeSlot)
+		{
+			ioBuffer.ResizeBytes(sizePosition, sizeSlot, sizeFieldSize);
+		}
+
+		ioBuffer.WriteBytesAt(sizePosition, sizeField, sizeFieldSize);
 
 		return kIABNoError;
 	}
 
 	// IABElement::DeSerializeHead() implementation
-	iabError IABElement::DeSerializeHead(StreamReader& streamReader)
+	template<typename ReaderType>
+	iabError IABElement::DeSerializeHead(ReaderType& streamReader)
 	{
 		// Element ID code is a Plex(8) coded data field
         Plex<8> parsedElementID;
@@ -601,7 +979,8 @@ namespace ImmersiveAudioBitstream
 	}
     
     // IABElement::SkipDeSerializeCurrentElement() implementation
-    iabError IABElement::SkipDeSerializeCurrentElement(StreamReader& streamReader)
+    template<typename ReaderType>
+    iabError IABElement::SkipDeSerializeCurrentElement(ReaderType& streamReader)
     {
         // Read Element ID and element size, then skip to new bitstream position according
         // to number of bytes given by element size
@@ -638,18 +1017,15 @@ namespace ImmersiveAudioBitstream
 
 
 	// IABElement::PeekNextElementID() implementation
-	iabError IABElement::PeekNextElementID(StreamReader& streamReader, uint32_t &oElementID)
+	template<typename ReaderType>
+	iabError IABElement::PeekNextElementID(ReaderType& streamReader, uint32_t &oElementID)
 	{
-        // Create a restorer to restore streamReader to the state before the peeking.
-        // BitStreamStateRestorerT destructor will automatically restore streamReader state when exiting this method
-        // Note that BitStreamStateRestorerT stream type must match streamReader stream type, see typedef at top of IABElements.h
-        // typedef BitStreamReaderT<std::istream> StreamReader;
-
-        BitStreamStateRestorerT<std::istream> streamReaderStateRestorer(&streamReader);
+        // Peek from the streamReader lookahead. The element ID is left in the reader buffer
+        // for the element DeSerialize() to read, without seeking the underlying stream.
 
 		Plex<8> nextElementID;
 
-		if (OK != read(streamReader, nextElementID))
+		if (OK != peek(streamReader, nextElementID))
 		{
 			return kIABParserIABFrameError;
 		}
@@ -678,6 +1054,22 @@ namespace ImmersiveAudioBitstream
 		numUnallowedFrameSubElements_ = 0;
 
 		packedSubElementCount_ = 0;				// To match number of element in frameSubElements_ that is packing enabled
+
+		bufferReader_ = nullptr;
+
+		recycledFrameRate_ = frameRate_;
+		recycledSampleRate_ = sampleRate_;
+		recycledBitDepth_ = bitDepth_;
+
+		arena_ = nullptr;
+		lazyAudioData_ = false;
+		borrowAudioData_ = false;
+		headerOnly_ = false;
+		subElementsSkipped_ = false;
+
+		frameSerializeBuffer_ = nullptr;
+		dlcCodecContext_ = nullptr;
+		audioDataIndexValid_ = false;
 	}
 
 	IABFrame::IABFrame(std::istream* inputStream) :
@@ -695,10 +1087,27 @@ namespace ImmersiveAudioBitstream
 
 		packedSubElementCount_ = 0;
 
+		bufferReader_ = nullptr;
+
+		recycledFrameRate_ = frameRate_;
+		recycledSampleRate_ = sampleRate_;
+		recycledBitDepth_ = bitDepth_;
+
+		arena_ = nullptr;
+		lazyAudioData_ = false;
+		borrowAudioData_ = false;
+		headerOnly_ = false;
+		subElementsSkipped_ = false;
+
+		frameSerializeBuffer_ = nullptr;
+		dlcCodecContext_ = nullptr;
+		audioDataIndexValid_ = false;
+
 		// Instantiate elementReader_ on inputStream
 		if (inputStream && inputStream->good())
 		{
 			elementReader_ = new StreamReader(*inputStream);
+			elementReader_->setBlockReadSize(kIABFrameReaderBlockSize);
 		}
 		else
 		{
@@ -708,10 +1117,68 @@ namespace ImmersiveAudioBitstream
 		}
 	}
 
+	IABFrame::IABFrame(const char* iFrameBuffer, uint32_t iBufferSize) :
+		IABElement(kIABElementID_IAFrame)
+	{
+		version_ = kIABDefaultFrameVersion;
+		sampleRate_ = kIABSampleRate_48000Hz;
+		bitDepth_ = kIABBitDepth_24Bit;
+		frameRate_ = kIABFrameRate_24FPS;
+		maxRendered_ = 0;
+		subElementCount_ = 0;
+        numSkippedFrameSubElementsInParsing_ = 0;
+		numUndefinedFrameSubElements_ = 0;
+		numUnallowedFrameSubElements_ = 0;
+
+		packedSubElementCount_ = 0;
+
+		bufferReader_ = nullptr;
+
+		recycledFrameRate_ = frameRate_;
+		recycledSampleRate_ = sampleRate_;
+		recycledBitDepth_ = bitDepth_;
+
+		arena_ = nullptr;
+		lazyAudioData_ = false;
+		borrowAudioData_ = false;
+		headerOnly_ = false;
+		subElementsSkipped_ = false;
+
+		frameSerializeBuffer_ = nullptr;
+		dlcCodecContext_ = nullptr;
+		audioDataIndexValid_ = false;
+
+		// Instantiate bufferReader_ on the frame data, read in place without copying
+		if (iFrameBuffer && (iBufferSize > 0))
+		{
+			bufferReader_ = new BufferReader(iFrameBuffer, static_cast<BitCount_t>(iBufferSize));
+		}
+		else
+		{
+			// Error to console for now.
+			// May move this to outside constrcutor as an initilization step for error reporting.
+			std::cerr << "!Error: Unable to create BufferReader due to empty frame data buffer." << std::endl;
+		}
+	}
+
     // Destructor
 	IABFrame::~IABFrame()
     {
 		DeleteSubElements();
+		DeleteRecycledSubElements();
+
+		delete bufferReader_;
+		bufferReader_ = nullptr;
+
+		// After sub-elements, which may be allocated from it
+		delete arena_;
+		arena_ = nullptr;
+
+		delete frameSerializeBuffer_;
+		frameSerializeBuffer_ = nullptr;
+
+		delete dlcCodecContext_;
+		dlcCodecContext_ = nullptr;
     }
 
 	// IABFrame::GetVersion() implementation
@@ -853,6 +1320,8 @@ namespace ImmersiveAudioBitstream
         // Now set the new list as current list.
         frameSubElements_ = iSubElements;
         subElementCount_ = count;
+        audioDataIndexValid_ = false;
+        subElementsSkipped_ = false;
         
         return kIABNoError;
 
@@ -1330,13 +1799,23 @@ namespace ImmersiveAudioBitstream
 
 		frameSubElements_.clear();
 		subElementCount_ = 0;
+		audioDataIndexValid_ = false;
+		subElementsSkipped_ = false;
 	}
     
 	// IABFrame::ClearSubElements() implementation
 	iabError IABFrame::ClearSubElements()
 	{
+		// Elements allocated from the frame arena are released with the frame
+		if (HasArenaAllocatedElement(frameSubElements_))
+		{
+			return kIABNotImplementedError;
+		}
+
 		frameSubElements_.clear();
 		subElementCount_ = 0;
+		audioDataIndexValid_ = false;
+		subElementsSkipped_ = false;
 
 		// Reset maxRendered_ to 0, as all sub elements are removed.
 		maxRendered_ = 0;
@@ -1382,10 +1861,18 @@ namespace ImmersiveAudioBitstream
 			// Find the matching entry from the list...
 			if (iSubElement == *iter)
 			{
+				// Elements allocated from the frame arena are released with the frame
+				if (IABFrameArenaObject::IsArenaAllocated(dynamic_cast<const void*>(iSubElement)))
+				{
+					errorCode = kIABNotImplementedError;
+					break;
+				}
+
 				// Erase the entry from list (but not delete *iter).
 				frameSubElements_.erase(iter);
 
 				subElementCount_ -= 1;				// Decrement subElementCount_ to account for removal of 1 entry
+				audioDataIndexValid_ = false;
 
 				errorCode = kIABNoError;
 				break;								// Entry found and removed. Break.
@@ -1432,6 +1919,7 @@ namespace ImmersiveAudioBitstream
 		// Not in sub element list, add.
 		frameSubElements_.push_back(iSubElement);
 		subElementCount_ += 1;						// Increment subElementCount_ to account for addition of 1 entry
+		audioDataIndexValid_ = false;
 
 		return kIABNoError;
 	}
@@ -1459,40 +1947,133 @@ namespace ImmersiveAudioBitstream
 
 	// IABFrame::Serialize() implementation
 	iabError IABFrame::Serialize(std::ostream &outStream)
+	{
+		// The whole IABitstreamFrame is packed in a single pass into frameSerializeBuffer_, which is
+		// kept from one frame to the next, and output at once.
+		if (!frameSerializeBuffer_)
+		{
+			frameSerializeBuffer_ = new IABSerializeBuffer();
+		}
+
+		frameSerializeBuffer_->Clear();
+
+		iabError errorCode = SerializeFrame();
+
+		if (errorCode != kIABNoError)
+		{
+			return errorCode;
+		}
+
+		outStream.write(frameSerializeBuffer_->GetData(), static_cast<std::streamsize>(frameSerializeBuffer_->GetSize()));
+
+		// Are we done? (TBD)
+
+		return kIABNoError;
+	}
+
+	// IABFrame::Serialize() implementation, into caller memory
+	iabError IABFrame::Serialize(uint8_t* oBuffer, uint32_t iBufferSize, uint32_t &oFrameSize)
+	{
+		oFrameSize = 0;
+
+		if (!oBuffer && (iBufferSize > 0))
+		{
+			return kIABBadArgumentsError;
+		}
+
+		if (!frameSerializeBuffer_)
+		{
+			frameSerializeBuffer_ = new IABSerializeBuffer();
+		}
+
+		// Pack in place into oBuffer. Should the frame not fit, frameSerializeBuffer_ carries on in its
+		// own storage, only to report the size required.
+		frameSerializeBuffer_->Attach(reinterpret_cast<char*>(oBuffer), iBufferSize);
+
+		iabError errorCode = SerializeFrame();
+		uint64_t frameSize = frameSerializeBuffer_->GetSize();
+		bool fits = frameSerializeBuffer_->IsAttached();
+		frameSerializeBuffer_->Detach();
+
+		if (errorCode != kIABNoError)
+		{
+			return errorCode;
+		}
+
+		if (frameSize > static_cast<uint64_t>(UINT32_MAX))
+		{
+			return kIABPackerGeneralError;
+		}
+
+		oFrameSize = static_cast<uint32_t>(frameSize);
+
+		return fits ? kIABNoError : kIABPackerBufferTooSmallError;
+	}
+
+	// IABFrame::SerializeFrame() implementation
+	iabError IABFrame::SerializeFrame()
+	{
+		IABSerializeBuffer& serializeBuffer = *frameSerializeBuffer_;
+
+		// Serialize preamble, as the first subframe of IABitstreamFrame. It fails for a frame parsed
+		// with its preamble payload skipped.
+		iabError errorCode = aPreamble_.Serialize(serializeBuffer.GetWriter());
+
+		if (errorCode != kIABNoError)
+		{
+			return errorCode;
+		}
+
+		// Serialize/Wrapping IABFrame, the wrapper for the 2nd subframe of IABitstreamFrame. Its
+		// length is filled in once the IABFrame element is packed.
+		uint64_t subframeLengthPosition = serializeBuffer.GetSize() + 1;
+		containerSubframeWrapper_.Serialize(serializeBuffer.GetWriter());
+
+		// The IABFrame element forms the "Value" of IA subframe
+		uint64_t subframePosition = serializeBuffer.GetSize();
+		errorCode = SerializeElement(serializeBuffer);
+
+		if (errorCode != kIABNoError)
+		{
+			return errorCode;
+		}
+
+		// Set length for containerSubframeWrapper_, a 32-bit field following the 8-bit tag
+		IABSubframeLengthType subframeLength = static_cast<IABSubframeLengthType>(serializeBuffer.GetSize() - subframePosition);
+		containerSubframeWrapper_.SetSubframeLength(subframeLength);
+
+		uint8_t lengthField[4];
+		lengthField[0] = static_cast<uint8_t>(subframeLength >> 24);
+		lengthField[1] = static_cast<uint8_t>(subframeLength >> 16);
+		lengthField[2] = static_cast<uint8_t>(subframeLength >> 8);
+		lengthField[3] = static_cast<uint8_t>(subframeLength);
+		serializeBuffer.WriteBytesAt(subframeLengthPosition, lengthField, 4);
+
+		return kIABNoError;
+	}
+
+	// IABFrame::SerializePayload() implementation
+	iabError IABFrame::SerializePayload(IABSerializeBuffer& ioBuffer)
 	{
 		// TODO: Error code for each write() should be checked.
 		// It is not, yet.
 
-		// *****************
-		// Wrapping the following for each call seem excessive? (Something for team discussion?)
-		// ReturnCode err = OK;
-		// 
-		// err = xxx.write();
-		// if (err != OK)
-		// {
-		// 	return err;
-		// }
-		// 
-		// // another write() call
-		// // ...
-		// 
-		// return err;
-		// *****************
-
-		// Set up payload writer and buffer
-		elementPayloadWriter_.align();										// reset writer byte alignment
-		elementPayloadBuffer_.seekp(0, std::ios::beg);						// reset internal payload buffer
-		elementPayloadBuffer_.clear();
-		elementHeadBuffer_.seekp(0, std::ios::beg);
-		elementHeadBuffer_.clear();
-
-		// Writing data fields (These are currently written into internal "elementPayloadBuffer_")
-		elementPayloadWriter_.write(version_, 8);
-		elementPayloadWriter_.write(static_cast<uint8_t>(sampleRate_), 2);
-		elementPayloadWriter_.write(static_cast<uint8_t>(bitDepth_), 2);
-		elementPayloadWriter_.write(static_cast<uint8_t>(frameRate_), 4);
+		// A frame parsed header only has none of its sub-elements to pack
+		if (subElementsSkipped_)
+		{
+			return kIABPackerGeneralError;
+		}
+
+		// Payload is appended to ioBuffer, see SerializeElement()
+		StreamWriter& payloadWriter = ioBuffer.GetWriter();
+
+		// Writing data fields
+		payloadWriter.write(version_, 8);
+		payloadWriter.write(static_cast<uint8_t>(sampleRate_), 2);
+		payloadWriter.write(static_cast<uint8_t>(bitDepth_), 2);
+		payloadWriter.write(static_cast<uint8_t>(frameRate_), 4);
 		// Calling method for writing Plex encoded field.
-		write(elementPayloadWriter_, Plex<8>(maxRendered_));
+		write(payloadWriter, Plex<8>(maxRendered_));
 
 		// Prepare to pack IABFrame sub elements, but is overall sub element packing disabled?
 		if (AreSubElementsEnabledForPacking())
@@ -1506,78 +2087,221 @@ namespace ImmersiveAudioBitstream
 			packedSubElementCount_ = 0;
 		}
 
-		elementPayloadWriter_.align();										// Alignment to byte
-		write(elementPayloadWriter_, Plex<8>(packedSubElementCount_));		// Note to use packedSubElementCount_
+		payloadWriter.align();										// Alignment to byte
+		write(payloadWriter, Plex<8>(packedSubElementCount_));		// Note to use packedSubElementCount_
 
 		// Pack sub elements, only when it is not disabled
 		if (AreSubElementsEnabledForPacking())
 		{
-			// Serialize all sub-elements, in sequence
-			// Append to end of IABFrame's "elementPayloadBuffer_"
-			for (IABElementCountType i = 0; i < subElementCount_; i++)
+			// Serialize all sub-elements, in sequence, after the frame payload
+			for (std::vector<IABElement*>::size_type i = 0; i < frameSubElements_.size(); i++)
 			{
-				// Temp StringStream to hold packed output from sub-elements (TODO: optimization?)
-				std::stringstream subElementPayload(std::stringstream::in | std::stringstream::out | std::stringstream::binary);
-				frameSubElements_[i]->Serialize(subElementPayload);
-				const std::string payLoad = subElementPayload.str();
-				uint32_t length = static_cast<uint32_t>(payLoad.size());
-				elementPayloadWriter_.write((uint8_t*)payLoad.data(), length);
+				// Sub-element head and payload follow in place. A sub-element that fails to serialize,
+				// for example an audio data element whose lazily parsed payload is corrupt, is left out
+				// by SerializeElement(), while packedSubElementCount_ counts it: fail the frame.
+				if (frameSubElements_[i]->IsIncludedForPacking())
+				{
+					iabError errorCode = frameSubElements_[i]->SerializeElement(ioBuffer);
+
+					if (errorCode != kIABNoError)
+					{
+						return errorCode;
+					}
+				}
 			}
 		}
 
-		// Get buffer length as payload, and set element size
-		IABElementSizeType packedPayloadLength = 0;
-		packedPayloadLength = static_cast<IABElementSizeType>(elementPayloadBuffer_.tellp());
-		SetElementSize(packedPayloadLength);
+		return kIABNoError;
+	}
 
-		// Serialize frame head
-		SerializeHead();
+	// IABFrame::DeSerialize() implementation
+	iabError IABFrame::DeSerialize()
+	{
+		// Sub-elements are allocated from arena_ while parsing, or from the heap if there is none
+		IABFrameArena::Scope arenaScope(arena_);
 
-		// Update packedPayloadLength to wrapper subframe length
-		packedPayloadLength += static_cast<IABElementSizeType>(elementHeadBuffer_.tellp());
+		if (bufferReader_)
+		{
+			return ParseFrame(*bufferReader_);
+		}
 
-		// Set length for containerSubframeWrapper_
-		containerSubframeWrapper_.SetSubframeLength(static_cast<IABSubframeLengthType>(packedPayloadLength));
+		if (!elementReader_)
+		{
+			return kIABParserBitstreamReaderNotPresentError;
+		}
 
-		// Serialize preamble, as the first subframe of IABitstreamFrame
-		aPreamble_.Serialize(outStream);
+		iabError errorCode = ParseFrame(*elementReader_);
 
-		// Serialize/Wrapping IABFrame, the wrapper for the 2nd subframe of IABitstreamFrame
-		containerSubframeWrapper_.Serialize(outStream);
+		// elementReader_ reads ahead in blocks. Return whatever belongs to the next frame
+		// to the input stream, where the next frame's reader expects to find it.
+		elementReader_->releaseLookahead();
 
-		// The combination of following forms the "Value" of IA subframe
-		// Output elementHeadBuffer_ first, followed by elementPayloadBuffer_
-		outStream << elementHeadBuffer_.rdbuf();
-		outStream << elementPayloadBuffer_.rdbuf();
+		return errorCode;
+	}
 
-		// Clear stream contents after packing
-		elementHeadBuffer_.str("");
-		elementPayloadBuffer_.str("");
+	// IABFrame::GetBufferBytesParsed() implementation
+	uint64_t IABFrame::GetBufferBytesParsed() const
+	{
+		if (!bufferReader_)
+		{
+			return 0;
+		}
 
-		// Are we done? (TBD)
+		return static_cast<uint64_t>(bufferReader_->streamPosition());
+	}
+
+	// IABFrame::Recycle() implementation
+	iabError IABFrame::Recycle()
+	{
+		// Parsing continues from the input stream, with elementReader_
+		if (!elementReader_ || bufferReader_)
+		{
+			return kIABParserBitstreamReaderNotPresentError;
+		}
+
+		ResetForRecycling();
 
 		return kIABNoError;
 	}
 
-	// IABFrame::DeSerialize() implementation
-	iabError IABFrame::DeSerialize()
+	iabError IABFrame::Recycle(const char* iFrameBuffer, uint32_t iBufferSize)
 	{
-		iabError errorCode = kIABNoError;
-		iabError errorCodePreamble = kIABNoError;
+		if ((nullptr == iFrameBuffer) || (0 == iBufferSize))
+		{
+			return kIABBadArgumentsError;
+		}
 
-		if (!elementReader_)
+		// Re-target bufferReader_ to the new frame data
+		delete bufferReader_;
+		bufferReader_ = new BufferReader(iFrameBuffer, static_cast<BitCount_t>(iBufferSize));
+
+		ResetForRecycling();
+
+		return kIABNoError;
+	}
+
+	// IABFrame::ResetForRecycling() implementation
+	void IABFrame::ResetForRecycling()
+	{
+		if (arena_)
 		{
-			return kIABParserBitstreamReaderNotPresentError;
+			// Allocating from the arena again is as cheap as re-using sub-elements. Release them at once.
+			DeleteSubElements();
+			arena_->Reset();
 		}
 
+		// Keep sub-elements for re-use by ParseFrameSubElement(), in their state on construction
+		for (std::vector<IABElement*>::iterator iter = frameSubElements_.begin(); iter != frameSubElements_.end(); iter++)
+		{
+			IABElementIDType elementID;
+			(*iter)->GetElementID(elementID);
+			(*iter)->ResetForReuse();
+			recycledSubElements_[elementID].push_back(*iter);
+		}
+
+		frameSubElements_.clear();
+		audioDataIndexValid_ = false;
+
+		// Sub-elements were constructed for these, see ParseFrameSubElement()
+		recycledFrameRate_ = frameRate_;
+		recycledSampleRate_ = sampleRate_;
+		recycledBitDepth_ = bitDepth_;
+
+		// Back to state on construction
+		IABElement::ResetForReuse();
+
+		version_ = kIABDefaultFrameVersion;
+		sampleRate_ = kIABSampleRate_48000Hz;
+		bitDepth_ = kIABBitDepth_24Bit;
+		frameRate_ = kIABFrameRate_24FPS;
+		maxRendered_ = 0;
+		subElementCount_ = 0;
+		numSkippedFrameSubElementsInParsing_ = 0;
+		numUndefinedFrameSubElements_ = 0;
+		numUnallowedFrameSubElements_ = 0;
+
+		packedSubElementCount_ = 0;
+		subElementsSkipped_ = false;
+
+		aPreamble_.SetPreamblePayload(nullptr, 0);
+		containerSubframeWrapper_.SetSubframeLength(0);
+	}
+
+	// IABFrame::EnableArena() implementation
+	void IABFrame::EnableArena()
+	{
+		if (!arena_)
+		{
+			arena_ = new IABFrameArena();
+		}
+	}
+
+	// IABFrame::SetLazyAudioData() implementation
+	void IABFrame::SetLazyAudioData(bool iEnable, bool iBorrowAudioData)
+	{
+		lazyAudioData_ = iEnable;
+		borrowAudioData_ = iBorrowAudioData;
+	}
+
+	// IABFrame::SetHeaderOnly() implementation
+	void IABFrame::SetHeaderOnly(bool iEnable)
+	{
+		headerOnly_ = iEnable;
+	}
+
+	// IABFrame::SetPreamblePayloadParsing() implementation
+	void IABFrame::SetPreamblePayloadParsing(bool iSkipPayload, bool iBorrowPayload)
+	{
+		aPreamble_.SetPayloadParsing(iSkipPayload, iBorrowPayload);
+	}
+
+	// IABFrame::DeleteRecycledSubElements() implementation
+	void IABFrame::DeleteRecycledSubElements()
+	{
+		for (std::map<IABElementIDType, std::vector<IABElement*> >::iterator iter = recycledSubElements_.begin(); iter != recycledSubElements_.end(); iter++)
+		{
+			for (std::vector<IABElement*>::iterator iterElement = iter->second.begin(); iterElement != iter->second.end(); iterElement++)
+			{
+				delete *iterElement;
+			}
+		}
+
+		recycledSubElements_.clear();
+	}
+
+	// IABFrame::TakeRecycledSubElement() implementation
+	IABElement* IABFrame::TakeRecycledSubElement(IABElementIDType iElementID)
+	{
+		std::map<IABElementIDType, std::vector<IABElement*> >::iterator iter = recycledSubElements_.find(iElementID);
+
+		if ((iter == recycledSubElements_.end()) || iter->second.empty())
+		{
+			return nullptr;
+		}
+
+		IABElement* subElement = iter->second.back();
+		iter->second.pop_back();
+
+		return subElement;
+	}
+
+	// IABFrame::ParseFrame() implementation
+	template<typename ReaderType>
+	iabError IABFrame::ParseFrame(ReaderType& streamReader)
+	{
+		iabError errorCode = kIABNoError;
+		iabError errorCodePreamble = kIABNoError;
+
+		subElementsSkipped_ = false;
+
 		// Align reader at beginning (do we need to?)
-		elementReader_->align();
+		streamReader.align();
 
 		// Per IAB specification, parsing (DeSerialize) of aPreamble_ and containerSubframeWrapper_
 		// shall be called in the following sequence to acertain subframe structures.
 		//
 		// Parsing PCM preamble sub-frame first
-		errorCode = aPreamble_.DeSerialize(*elementReader_);
+		errorCode = aPreamble_.DeSerialize(streamReader);
 		
 		if (errorCode != kIABNoError)
 		{
@@ -1598,18 +2322,23 @@ namespace ImmersiveAudioBitstream
 		}
 
 		// Parsing IA subframe wrapper header
-		errorCode = containerSubframeWrapper_.DeSerialize(*elementReader_);
+		errorCode = containerSubframeWrapper_.DeSerialize(streamReader);
 
 		if (errorCode != kIABNoError)
 		{
 			return errorCode;
 		}
 
+		// The IAFrame element takes up the IA subframe payload
+		IABSubframeLengthType iaSubframeLength = 0;
+		containerSubframeWrapper_.GetSubframeLength(iaSubframeLength);
+		std::ios_base::streampos iaSubframeEnd = streamReader.streamPosition() + static_cast<std::streamoff>(iaSubframeLength);
+
 		// After subframe structures or headers are validated, moving to parse the IA frame contents
 		//
 		// At the beginning/ first byte of IABFrame element
 		// Parsing element ID and size
-		errorCode = DeSerializeHead(*elementReader_);
+		errorCode = DeSerializeHead(streamReader);
 
 		if (errorCode != kIABNoError)
 		{
@@ -1617,17 +2346,41 @@ namespace ImmersiveAudioBitstream
 		}
 
 		// Parsing Frame data fields
-		errorCode = ParseFrameDataFields();
+		errorCode = ParseFrameDataFields(streamReader);
 
 		if (errorCode != kIABNoError)
 		{
 			return errorCode;
 		}
 
+		if (headerOnly_)
+		{
+			// subElementCount_ is kept as read, with no sub-element parsed
+			subElementsSkipped_ = true;
+			errorCode = SkipFrameBody(streamReader, iaSubframeEnd);
+
+			if (errorCode != kIABNoError)
+			{
+				return errorCode;
+			}
+
+			return errorCodePreamble;
+		}
+
+		// Sub-elements kept by Recycle() were constructed for the previous frame's parameters
+		if ((frameRate_ != recycledFrameRate_) || (sampleRate_ != recycledSampleRate_) || (bitDepth_ != recycledBitDepth_))
+		{
+			DeleteRecycledSubElements();
+		}
+
+		// Audio data sub-elements are indexed as they are parsed
+		audioDataElements_.clear();
+		audioDataIndexValid_ = false;
+
 		// Parse subElementCount_ number of sub-element
 		for (uint32_t i = 0; i < static_cast<uint32_t>(subElementCount_); i++)
         {
-			errorCode = ParseFrameSubElement();
+			errorCode = ParseFrameSubElement(streamReader);
 
 			if (errorCode != kIABNoError)
 			{
@@ -1635,19 +2388,47 @@ namespace ImmersiveAudioBitstream
 			}
         }
         
+		// Sort them by AudioDataID for look-up
+		audioDataIndexValid_ = true;
+		UpdateAudioDataIndex();
+
         // If any bitstream elements have been skipped by the parser, deduct them from sub-element count read from the bitstream
         subElementCount_ -= numSkippedFrameSubElementsInParsing_;
 
 		return errorCodePreamble;
 	}
     
+	// IABFrame::SkipFrameBody() implementation
+	template<typename ReaderType>
+	iabError IABFrame::SkipFrameBody(ReaderType& streamReader, std::ios_base::streampos iSubframeEnd)
+	{
+		// Frame data fields must fit in the IA subframe
+		if (streamReader.streamPosition() > iSubframeEnd)
+		{
+			return kIABParserIABFrameError;
+		}
+
+		// Check that the frame is complete by reading the last byte of the IA subframe, which
+		// leaves the reader past the frame. A frame cut short is an error, not the end of the stream.
+		uint8_t lastByte = 0;
+		streamReader.streamPosition(iSubframeEnd - static_cast<std::streamoff>(1));
+
+		if (OK != streamReader.read(lastByte))
+		{
+			return kIABParserIABFrameError;
+		}
+
+		return kIABNoError;
+	}
+
 	// IABFrame::ParseFrameDataFields() implementation
-	iabError IABFrame::ParseFrameDataFields()
+	template<typename ReaderType>
+	iabError IABFrame::ParseFrameDataFields(ReaderType& streamReader)
     {
         uint8_t	fixedLengthField = 0;
         
         // bitstream version is 8-bit
-        if (OK != elementReader_->read(fixedLengthField))
+        if (OK != streamReader.read(fixedLengthField))
         {
             return kIABParserIABFrameError;
         }
@@ -1660,7 +2441,7 @@ namespace ImmersiveAudioBitstream
         version_ = fixedLengthField;
         
         // Audio sample rate is 2-bit
-        if (OK != elementReader_->read(fixedLengthField, 2))
+        if (OK != streamReader.read(fixedLengthField, 2))
         {
             return kIABParserIABFrameError;
         }
@@ -1674,7 +2455,7 @@ namespace ImmersiveAudioBitstream
         sampleRate_ = static_cast<IABSampleRateType>(fixedLengthField);
         
         // Audio sample bit depth is 2-bit
-        if (OK != elementReader_->read(fixedLengthField, 2))
+        if (OK != streamReader.read(fixedLengthField, 2))
         {
             return kIABParserIABFrameError;
         }
@@ -1688,7 +2469,7 @@ namespace ImmersiveAudioBitstream
         bitDepth_ = static_cast<IABBitDepthType>(fixedLengthField);
         
         // Frame rate is 4-bit
-        if (OK != elementReader_->read(fixedLengthField, 4))
+        if (OK != streamReader.read(fixedLengthField, 4))
         {
             return kIABParserIABFrameError;
         }
@@ -1703,7 +2484,7 @@ namespace ImmersiveAudioBitstream
         Plex<8> plexField;
         
         // Maxrendered field is plex 8 coded
-        if (OK != read(*elementReader_, plexField))
+        if (OK != read(streamReader, plexField))
         {
             return kIABParserIABFrameError;
         }
@@ -1711,7 +2492,7 @@ namespace ImmersiveAudioBitstream
         maxRendered_ = static_cast<IABMaxRenderedRangeType>(plexField);
         
         // Frame sub-element count field is plex 8 coded
-        if (OK != read(*elementReader_, plexField))
+        if (OK != read(streamReader, plexField))
         {
             return kIABParserIABFrameError;
         }
@@ -1722,74 +2503,79 @@ namespace ImmersiveAudioBitstream
     }
     
 	// IABFrame::ParseFrameSubElement() implementation
-	iabError IABFrame::ParseFrameSubElement()
+	template<typename ReaderType>
+	iabError IABFrame::ParseFrameSubElement(ReaderType& streamReader)
     {
 		uint32_t parsedElementIDField;
         IABElementIDType elementID;
 
 		// Peek the next (Plex<8> coded) element/sub-element ID field
-        if (kIABNoError != PeekNextElementID(*elementReader_, parsedElementIDField))
+        if (kIABNoError != PeekNextElementID(streamReader, parsedElementIDField))
         {
             return kIABParserParsingError;
         }
 
 		elementID = static_cast<IABElementIDType>(parsedElementIDField);
 
-		IABElement* frameSubElement = nullptr;
-        
-        switch (elementID)
-        {
-            case kIABElementID_BedDefinition:
-				frameSubElement = new IABBedDefinition(frameRate_);
-				break;
+		// Re-use a sub-element of the same type kept by Recycle(), if any
+		IABElement* frameSubElement = TakeRecycledSubElement(elementID);
+
+		if (nullptr == frameSubElement)
+		{
+            switch (elementID)
+            {
+                case kIABElementID_BedDefinition:
+					frameSubElement = new IABBedDefinition(frameRate_);
+					break;
                 
-            case kIABElementID_ObjectDefinition:
-				frameSubElement = new IABObjectDefinition(frameRate_);
-				break;
+                case kIABElementID_ObjectDefinition:
+					frameSubElement = new IABObjectDefinition(frameRate_);
+					break;
                 
-            case kIABElementID_AudioDataDLC:
-				frameSubElement = dynamic_cast<IABAudioDataDLC*>(IABAudioDataDLCInterface::Create(frameRate_, sampleRate_));
+                case kIABElementID_AudioDataDLC:
+					frameSubElement = dynamic_cast<IABAudioDataDLC*>(IABAudioDataDLCInterface::Create(frameRate_, sampleRate_));
 
-				// For DCL, check if a valid frameSubElement is returned
-				// DLC is not supported for all frame rates
-				if (!frameSubElement)
-				{
-					return kIABDataFieldInvalidDLC;
-				}
-                break;
+					// For DCL, check if a valid frameSubElement is returned
+					// DLC is not supported for all frame rates
+					if (!frameSubElement)
+					{
+						return kIABDataFieldInvalidDLC;
+					}
+                    break;
                 
-            case kIABElementID_AuthoringToolInfo:
-                frameSubElement = new IABAuthoringToolInfo();
-                break;
+                case kIABElementID_AuthoringToolInfo:
+                    frameSubElement = new IABAuthoringToolInfo();
+                    break;
                 
-            case kIABElementID_UserData:
-                frameSubElement = new IABUserData();
-                break;
-
-			case kIABElementID_AudioDataPCM:
-				// AudioDataPCM element instantiated using 3 parameter values already parsed in during ParseFrameDataFields() call
-				frameSubElement = new IABAudioDataPCM(frameRate_, sampleRate_, bitDepth_);
-				break;
-
-			// Known type but invalid type as IAB frame sub-element
-			// Total number of unallowed element IDs for the frame is tracked in numUnallowedFrameSubElements_.
-			// IAFrame having a sub-element of IAFrame type is also not allowed.
-			case kIABElementID_IAFrame:
-			case kIABElementID_BedRemap:
-			case kIABElementID_ObjectZoneDefinition19:
-				SkipDeSerializeCurrentElement(*elementReader_);
-				numSkippedFrameSubElementsInParsing_++;
-				numUnallowedFrameSubElements_++;
-				return kIABNoError;										// Exit, as frameSubElement == nullptr for this case
+                case kIABElementID_UserData:
+                    frameSubElement = new IABUserData();
+                    break;
 
-			// Undefined/Unknown type as IAB frame sub-element
-			// Total number of unallowed element IDs for the frame is tracked in numUndefinedFrameSubElements_.
-			default:
-				SkipDeSerializeCurrentElement(*elementReader_);
-                numSkippedFrameSubElementsInParsing_++;
-				numUndefinedFrameSubElements_++;
-                return kIABNoError;										// Exit, as frameSubElement == nullptr for default case
-        }
+				case kIABElementID_AudioDataPCM:
+					// AudioDataPCM element instantiated using 3 parameter values already parsed in during ParseFrameDataFields(streamReader) call
+					frameSubElement = new IABAudioDataPCM(frameRate_, sampleRate_, bitDepth_);
+					break;
+
+				// Known type but invalid type as IAB frame sub-element
+				// Total number of unallowed element IDs for the frame is tracked in numUnallowedFrameSubElements_.
+				// IAFrame having a sub-element of IAFrame type is also not allowed.
+				case kIABElementID_IAFrame:
+				case kIABElementID_BedRemap:
+				case kIABElementID_ObjectZoneDefinition19:
+					SkipDeSerializeCurrentElement(streamReader);
+					numSkippedFrameSubElementsInParsing_++;
+					numUnallowedFrameSubElements_++;
+					return kIABNoError;										// Exit, as frameSubElement == nullptr for this case
+
+				// Undefined/Unknown type as IAB frame sub-element
+				// Total number of unallowed element IDs for the frame is tracked in numUndefinedFrameSubElements_.
+				default:
+					SkipDeSerializeCurrentElement(streamReader);
+                    numSkippedFrameSubElementsInParsing_++;
+					numUndefinedFrameSubElements_++;
+                    return kIABNoError;										// Exit, as frameSubElement == nullptr for default case
+            }
+		}
 
 		// Check validity of frameSubElement
 		if (nullptr == frameSubElement)
@@ -1800,7 +2586,18 @@ namespace ImmersiveAudioBitstream
 		// Parse sub-element
         iabError returnCode = kIABNoError;
         
-        returnCode = frameSubElement->DeSerialize(*elementReader_);
+        if (lazyAudioData_ && (kIABElementID_AudioDataDLC == elementID))
+        {
+            returnCode = dynamic_cast<IABAudioDataDLC*>(frameSubElement)->DeSerializeLazy(streamReader, borrowAudioData_);
+        }
+        else if (lazyAudioData_ && (kIABElementID_AudioDataPCM == elementID))
+        {
+            returnCode = dynamic_cast<IABAudioDataPCM*>(frameSubElement)->DeSerializeLazy(streamReader, borrowAudioData_);
+        }
+        else
+        {
+            returnCode = frameSubElement->DeSerialize(streamReader);
+        }
         
         if (returnCode != kIABNoError)
         {
@@ -1809,10 +2606,212 @@ namespace ImmersiveAudioBitstream
         }
         
 		frameSubElements_.push_back(frameSubElement);				// Save to frame sub element list
+		AddAudioDataEntry(frameSubElement, elementID);
 
         return kIABNoError;
     }
 
+	// IABFrame::AddAudioDataEntry() implementation
+	void IABFrame::AddAudioDataEntry(IABElement* iSubElement, IABElementIDType iElementID)
+	{
+		AudioDataEntry entry;
+		entry.dlcElement_ = nullptr;
+		entry.pcmElement_ = nullptr;
+
+		if (kIABElementID_AudioDataDLC == iElementID)
+		{
+			entry.dlcElement_ = dynamic_cast<IABAudioDataDLC*>(iSubElement);
+			entry.dlcElement_->GetAudioDataID(entry.audioDataID_);
+		}
+		else if (kIABElementID_AudioDataPCM == iElementID)
+		{
+			entry.pcmElement_ = dynamic_cast<IABAudioDataPCM*>(iSubElement);
+			entry.pcmElement_->GetAudioDataID(entry.audioDataID_);
+		}
+		else
+		{
+			return;
+		}
+
+		audioDataElements_.push_back(entry);
+	}
+
+	// IABFrame::UpdateAudioDataIndex() implementation
+	void IABFrame::UpdateAudioDataIndex()
+	{
+		if (!audioDataIndexValid_)
+		{
+			// Sub-element list changed after parsing, or parsing did not complete
+			audioDataElements_.clear();
+
+			for (std::vector<IABElement*>::iterator iter = frameSubElements_.begin(); iter != frameSubElements_.end(); iter++)
+			{
+				IABElementIDType elementID;
+				(*iter)->GetElementID(elementID);
+				AddAudioDataEntry(*iter, elementID);
+			}
+		}
+
+		// Stable, so that the first of sub-elements sharing an AudioDataID is found
+		audioDataIndex_ = audioDataElements_;
+		std::stable_sort(audioDataIndex_.begin(), audioDataIndex_.end(), IsAudioDataIDLess);
+
+		audioDataIndexValid_ = true;
+	}
+
+	// IABFrame::CheckAudioDataIndex() implementation
+	void IABFrame::CheckAudioDataIndex()
+	{
+		if (!audioDataIndexValid_)
+		{
+			UpdateAudioDataIndex();
+			return;
+		}
+
+		// AudioDataIDs may have been set on the sub-elements since they were indexed
+		bool audioDataIDChanged = false;
+
+		for (std::vector<AudioDataEntry>::iterator iter = audioDataElements_.begin(); iter != audioDataElements_.end(); iter++)
+		{
+			IABAudioDataIDType audioDataID = 0;
+
+			if (iter->dlcElement_)
+			{
+				iter->dlcElement_->GetAudioDataID(audioDataID);
+			}
+			else
+			{
+				iter->pcmElement_->GetAudioDataID(audioDataID);
+			}
+
+			if (audioDataID != iter->audioDataID_)
+			{
+				iter->audioDataID_ = audioDataID;
+				audioDataIDChanged = true;
+			}
+		}
+
+		if (audioDataIDChanged)
+		{
+			UpdateAudioDataIndex();
+		}
+	}
+
+	// IABFrame::IsAudioDataIDLess() implementation
+	bool IABFrame::IsAudioDataIDLess(const AudioDataEntry& iLeft, const AudioDataEntry& iRight)
+	{
+		return iLeft.audioDataID_ < iRight.audioDataID_;
+	}
+
+	// IABFrame::GetAudioDataIDs() implementation
+	void IABFrame::GetAudioDataIDs(std::vector<IABAudioDataIDType> &oAudioDataIDs)
+	{
+		CheckAudioDataIndex();
+
+		oAudioDataIDs.clear();
+
+		for (std::vector<AudioDataEntry>::const_iterator iter = audioDataElements_.begin(); iter != audioDataElements_.end(); iter++)
+		{
+			oAudioDataIDs.push_back(iter->audioDataID_);
+		}
+	}
+
+	// IABFrame::DecodeAudioData() implementation
+	iabError IABFrame::DecodeAudioData(IABAudioDataIDType iAudioDataID, int32_t* oSamples, uint32_t iSampleCount)
+	{
+		if ((nullptr == oSamples) || (0 == iSampleCount))
+		{
+			return kIABBadArgumentsError;
+		}
+
+		CheckAudioDataIndex();
+
+		AudioDataEntry key;
+		key.audioDataID_ = iAudioDataID;
+
+		std::vector<AudioDataEntry>::const_iterator entry = std::lower_bound(audioDataIndex_.begin(), audioDataIndex_.end(), key, IsAudioDataIDLess);
+
+		if ((entry == audioDataIndex_.end()) || (entry->audioDataID_ != iAudioDataID))
+		{
+			return kIABNoSuchParameterError;
+		}
+
+		return DecodeAudioDataEntry(*entry, oSamples, iSampleCount);
+	}
+
+	// IABFrame::DecodeAllAudioData() implementation
+	iabError IABFrame::DecodeAllAudioData(int32_t* const* oSamples, uint32_t iNumBuffers, uint32_t iSampleCount)
+	{
+		if ((nullptr == oSamples) || (0 == iSampleCount))
+		{
+			return kIABBadArgumentsError;
+		}
+
+		CheckAudioDataIndex();
+
+		if (iNumBuffers != audioDataElements_.size())
+		{
+			return kIABBadArgumentsError;
+		}
+
+		// DLC elements share one codec context. Use the current one, or the frame's own.
+		IABDLCCodecContext* context = IABDLCCodecContext::GetCurrent();
+
+		if (!context)
+		{
+			if (!dlcCodecContext_)
+			{
+				dlcCodecContext_ = new IABDLCCodecContext();
+			}
+
+			context = dlcCodecContext_;
+		}
+
+		IABDLCCodecContext::Scope contextScope(context);
+
+		for (uint32_t i = 0; i < iNumBuffers; i++)
+		{
+			if (nullptr == oSamples[i])
+			{
+				return kIABBadArgumentsError;
+			}
+
+			iabError errorCode = DecodeAudioDataEntry(audioDataElements_[i], oSamples[i], iSampleCount);
+
+			if (errorCode != kIABNoError)
+			{
+				return errorCode;
+			}
+		}
+
+		return kIABNoError;
+	}
+
+	// IABFrame::DecodeAudioDataEntry() implementation
+	iabError IABFrame::DecodeAudioDataEntry(const AudioDataEntry& iEntry, int32_t* oSamples, uint32_t iSampleCount)
+	{
+		if (iEntry.dlcElement_)
+		{
+			IABSampleRateType dlcSampleRate = kIABSampleRate_48000Hz;
+
+			// Decode at the sample rate the element is coded at
+			if ((kIABNoError != iEntry.dlcElement_->GetDLCSampleRate(dlcSampleRate)) ||
+				(kIABNoError != iEntry.dlcElement_->DecodeDLCToMonoPCM(oSamples, iSampleCount, dlcSampleRate)))
+			{
+				return kIABParserDLCDecodingError;
+			}
+
+			return kIABNoError;
+		}
+
+		if (kIABNoError != iEntry.pcmElement_->UnpackPCMToMonoSamples(oSamples, iSampleCount))
+		{
+			return kIABParserPCMUnpackingError;
+		}
+
+		return kIABNoError;
+	}
+
 	// IABFrame::UpdatePackEnabledSubElementCount() implementation
 	void IABFrame::UpdatePackingEnabledSubElementCount()
 	{
@@ -1931,7 +2930,7 @@ namespace ImmersiveAudioBitstream
 		// BedDefinition element, without alignment manipulation
 		// ! Do not change alignment when writing individual IAB channels
 
-		// Writing data fields (These are currently written into internal "elementPayloadBuffer_")
+		// Writing data fields
 		write(streamWriter, Plex<4>(channelID_));
 		write(streamWriter, Plex<8>(audioDataID_));
 
@@ -1958,7 +2957,8 @@ namespace ImmersiveAudioBitstream
 	}
 
 	// IABChannel::DeSerialize() implementation
-	iabError IABChannel::DeSerialize(StreamReader& streamReader)
+	template<typename ReaderType>
+	iabError IABChannel::DeSerializeElement(ReaderType& streamReader)
 	{
         uint8_t	fixedLengthFieldMax8 = 0;
         uint16_t fixedLengthFieldMax16 = 0;
@@ -2056,6 +3056,16 @@ namespace ImmersiveAudioBitstream
 
 		return kIABNoError;
 	}
+
+	iabError IABChannel::DeSerialize(StreamReader& streamReader)
+	{
+		return DeSerializeElement(streamReader);
+	}
+
+	iabError IABChannel::DeSerialize(BufferReader& streamReader)
+	{
+		return DeSerializeElement(streamReader);
+	}
     
     // IABChannel::Validate() implementation
     bool IABChannel::Validate(IABEventHandler &iEvenHandler, ValidationIssue &iValidationIssue) const
@@ -2560,6 +3570,12 @@ namespace ImmersiveAudioBitstream
 	// IABBedDefinition::ClearSubElements() implementation
 	iabError IABBedDefinition::ClearSubElements()
 	{
+		// Elements allocated from the frame arena are released with the frame
+		if (HasArenaAllocatedElement(bedSubElements_))
+		{
+			return kIABNotImplementedError;
+		}
+
 		bedSubElements_.clear();
 		subElementCount_ = 0;
 
@@ -2604,6 +3620,13 @@ namespace ImmersiveAudioBitstream
 			// Find the matching entry from the list...
 			if (iSubElement == *iter)
 			{
+				// Elements allocated from the frame arena are released with the frame
+				if (IABFrameArenaObject::IsArenaAllocated(dynamic_cast<const void*>(iSubElement)))
+				{
+					errorCode = kIABNotImplementedError;
+					break;
+				}
+
 				// Erase the entry from list (but not delete *iter).
 				bedSubElements_.erase(iter);
 
@@ -2675,91 +3698,67 @@ namespace ImmersiveAudioBitstream
 		return IABElement::IsIncludedForPacking();
 	}
 
-	// IABBedDefinition::Serialize() implementation
-	iabError IABBedDefinition::Serialize(std::ostream &outStream)
+	// IABBedDefinition::SerializePayload() implementation
+	iabError IABBedDefinition::SerializePayload(IABSerializeBuffer& ioBuffer)
 	{
-		// Check if "this" element is included in packing. If not, simply return with no further processing
-		if (!IsIncludedForPacking())
-		{
-			return kIABNoError;
-		}
-		else
-		{
-			// Yes, included. Update sub element count for sub element packing
-			UpdatePackingEnabledSubElementCount();
-		}
+		// Update sub element count for sub element packing
+		UpdatePackingEnabledSubElementCount();
 
-		// Set up payload writer and buffer
-		elementPayloadWriter_.align();										// reset writer byte alignment
-		elementPayloadBuffer_.seekp(0, std::ios::beg);						// reset internal payload buffer
-		elementPayloadBuffer_.clear();
-		elementHeadBuffer_.seekp(0, std::ios::beg);
-		elementHeadBuffer_.clear();
+		// Payload is appended to ioBuffer, see SerializeElement()
+		StreamWriter& payloadWriter = ioBuffer.GetWriter();
 
-		// Writing data fields (These are currently written into internal "elementPayloadBuffer_")
+		// Writing data fields
 		// Calling method for writing Plex encoded field.
-		write(elementPayloadWriter_, Plex<8>(metadataID_));
+		write(payloadWriter, Plex<8>(metadataID_));
 
-		elementPayloadWriter_.write(conditionalBed_, 1);
+		payloadWriter.write(conditionalBed_, 1);
 		if (conditionalBed_ == 1)
 		{
-			elementPayloadWriter_.write(static_cast<uint8_t>(bedUseCase_), 8);
+			payloadWriter.write(static_cast<uint8_t>(bedUseCase_), 8);
 		}
 
-		write(elementPayloadWriter_, Plex<4>(channelCount_));
+		write(payloadWriter, Plex<4>(channelCount_));
 
 		// Serialize all bed channels, in sequence, into payload writer
 		for (IABChannelCountType i = 0; i < channelCount_; i++)
 		{
-			bedChannels_[i]->Serialize(elementPayloadWriter_);
+			bedChannels_[i]->Serialize(payloadWriter);
 		}
 
-		elementPayloadWriter_.write(reserved_, 10);							// Reserved field, after all channels
-		elementPayloadWriter_.align();										// Align to byte
+		payloadWriter.write(reserved_, 10);							// Reserved field, after all channels
+		payloadWriter.align();										// Align to byte
 
-		elementPayloadWriter_.write(static_cast<uint8_t>(audioDescription_.audioDescription_), 8);
+		payloadWriter.write(static_cast<uint8_t>(audioDescription_.audioDescription_), 8);
 
 		if (audioDescription_.audioDescription_ & 0x80)
 		{
             // Write audio description text to bitstream as a null terminated string (i.e. character sequence)
             // writeStringAppendNull() will add a null byte after the last character of the string.
-            writeStringAppendNull(elementPayloadWriter_, audioDescription_.audioDescriptionText_);
+            writeStringAppendNull(payloadWriter, audioDescription_.audioDescriptionText_);
 		}
 
-		write(elementPayloadWriter_, Plex<8>(packedSubElementCount_));		// Note to write packedSubElementCount_ instead of subElementCount_
-		// Serialize all sub-elements, in sequence
-		// Append to end of IABBedDefinition's "elementPayloadBuffer_"
+		write(payloadWriter, Plex<8>(packedSubElementCount_));		// Note to write packedSubElementCount_ instead of subElementCount_
+		// Serialize all sub-elements, in sequence, after the bed definition payload
 		for (IABElementCountType i = 0; i < subElementCount_; i++)			// Still loop through all subElementCount_ of sub elements
 		{
-			// Temp StringStream to hold packed output from sub-elements (TODO: optimization?)
-			std::stringstream subElementPayload(std::stringstream::in | std::stringstream::out | std::stringstream::binary);
-			bedSubElements_[i]->Serialize(subElementPayload);
-			const std::string payLoad = subElementPayload.str();
-			uint32_t length = static_cast<uint32_t>(payLoad.size());
-			elementPayloadWriter_.write((uint8_t*)payLoad.data(), length);
-		}
-
-		// Get buffer length as payload, and set element size
-		IABElementSizeType packedPayloadLength = 0;
-		packedPayloadLength = static_cast<IABElementSizeType>(elementPayloadBuffer_.tellp());
-		SetElementSize(packedPayloadLength);
-
-		// Serialize frame head
-		SerializeHead();
-
-		// Output elementHeadBuffer_ first, followed by elementPayloadBuffer_
-		outStream << elementHeadBuffer_.rdbuf();
-		outStream << elementPayloadBuffer_.rdbuf();
+			// Sub-element head and payload follow in place. One that fails to serialize fails this element.
+			if (bedSubElements_[i]->IsIncludedForPacking())
+			{
+				iabError errorCode = bedSubElements_[i]->SerializeElement(ioBuffer);
 
-		// Clear stream contents after packing
-		elementHeadBuffer_.str("");
-		elementPayloadBuffer_.str("");
+				if (errorCode != kIABNoError)
+				{
+					return errorCode;
+				}
+			}
+		}
 
 		return kIABNoError;
 	}
 
 	// IABBedDefinition::DeSerialize() implementation
-	iabError IABBedDefinition::DeSerialize(StreamReader& streamReader)
+	template<typename ReaderType>
+	iabError IABBedDefinition::DeSerializeElement(ReaderType& streamReader)
 	{
 		iabError errorCode = kIABNoError;
 
@@ -2882,9 +3881,42 @@ namespace ImmersiveAudioBitstream
             return kIABParserIABBedDefinitionError;
         }
 	}
+
+	iabError IABBedDefinition::DeSerialize(StreamReader& streamReader)
+	{
+		return DeSerializeElement(streamReader);
+	}
+
+	iabError IABBedDefinition::DeSerialize(BufferReader& streamReader)
+	{
+		return DeSerializeElement(streamReader);
+	}
+
+	// IABBedDefinition::ResetForReuse() implementation
+	void IABBedDefinition::ResetForReuse()
+	{
+		IABElement::ResetForReuse();
+
+		DeleteBedChannels();
+		DeleteSubElements();
+
+		metadataID_ = 0;
+		conditionalBed_ = 0;
+		bedUseCase_ = kIABUseCase_9_1_OH;
+		channelCount_ = 0;
+		reserved_ = 0x180;
+		audioDescription_.audioDescription_ = kIABAudioDescription_NotIndicated;
+		audioDescription_.audioDescriptionText_.clear();
+		numSkippedBedSubElementsInParsing_ = 0;
+		numUndefinedBedSubElements_ = 0;
+		numUnallowedBedSubElements_ = 0;
+
+		packedSubElementCount_ = 0;
+	}
     
 	// IABBedDefinition::ParseBedChannel() implementation
-	iabError IABBedDefinition::ParseBedChannel(StreamReader& streamReader)
+	template<typename ReaderType>
+	iabError IABBedDefinition::ParseBedChannel(ReaderType& streamReader)
     {
 		iabError errorCode = kIABNoError;
 	
@@ -2911,7 +3943,8 @@ namespace ImmersiveAudioBitstream
     }
 
 	// IABBedDefinition::ParseBedSubElement() implementation
-	iabError IABBedDefinition::ParseBedSubElement(StreamReader& streamReader)
+	template<typename ReaderType>
+	iabError IABBedDefinition::ParseBedSubElement(ReaderType& streamReader)
     {
 		uint32_t parsedElementIDField;
 		IABElementIDType elementID;
@@ -2945,7 +3978,7 @@ namespace ImmersiveAudioBitstream
 			case kIABElementID_AudioDataDLC:
 			case kIABElementID_AudioDataPCM:
 			case kIABElementID_IAFrame:
-				SkipDeSerializeCurrentElement(*elementReader_);
+				SkipDeSerializeCurrentElement(streamReader);
 				numSkippedBedSubElementsInParsing_++;
 				numUnallowedBedSubElements_++;
 				return kIABNoError;										// Exit, as bedDefinitionSubElement == nullptr for this case
@@ -2953,7 +3986,7 @@ namespace ImmersiveAudioBitstream
 			// Undefined/Unknown type as IAB BedDefinition sub-element
 			// Total number of unallowed element IDs for the bed is tracked in numUndefinedBedSubElements_.
 			default:
-				SkipDeSerializeCurrentElement(*elementReader_);
+				SkipDeSerializeCurrentElement(streamReader);
 				numSkippedBedSubElementsInParsing_++;
 				numUndefinedBedSubElements_++;
 				return kIABNoError;										// Exit, as bedDefinitionSubElement == nullptr for default case
@@ -3735,7 +4768,7 @@ namespace ImmersiveAudioBitstream
 		// IABBedRemap element, without alignment manipulation
 		// ! Do not change alignment when writing individual remap sub blocks.
 
-		// Writing data fields (These are currently written into internal "elementPayloadBuffer_")
+		// Writing data fields
 		streamWriter.write(remapInfoExists_, 1);
 
 		if (remapInfoExists_ == 1)
@@ -3756,7 +4789,7 @@ namespace ImmersiveAudioBitstream
 		// IABBedRemap element, without alignment manipulation
 		// ! Do not change alignment when writing individual remap sub blocks.
 
-		// Writing data fields (These are currently written into internal "elementPayloadBuffer_")
+		// Writing data fields
 
 		// For first remap sub block, remapInfoExists_ is always 1 by specification. (This flag is not in bitstream.)
 
@@ -3798,7 +4831,8 @@ namespace ImmersiveAudioBitstream
 	}
 
 	// IABBedRemapSubBlock::DeSerialize() implementation
-	iabError IABBedRemapSubBlock::DeSerialize(StreamReader& streamReader)
+	template<typename ReaderType>
+	iabError IABBedRemapSubBlock::DeSerializeElement(ReaderType& streamReader)
 	{
 		iabError errorCode = kIABNoError;
 
@@ -3820,8 +4854,19 @@ namespace ImmersiveAudioBitstream
 		return errorCode;
 	}
 
+	iabError IABBedRemapSubBlock::DeSerialize(StreamReader& streamReader)
+	{
+		return DeSerializeElement(streamReader);
+	}
+
+	iabError IABBedRemapSubBlock::DeSerialize(BufferReader& streamReader)
+	{
+		return DeSerializeElement(streamReader);
+	}
+
 	// IABBedRemapSubBlock::DeSerializeSubBlock() implementation
-	iabError IABBedRemapSubBlock::DeSerializeSubBlock(StreamReader& streamReader)
+	template<typename ReaderType>
+	iabError IABBedRemapSubBlock::DeSerializeSubBlock(ReaderType& streamReader)
 	{
 		iabError returnCode = kIABNoError;
 
@@ -4246,28 +5291,18 @@ namespace ImmersiveAudioBitstream
 		return IABElement::IsIncludedForPacking();
 	}
 
-	// IABBedRemap::Serialize() implementation
-	iabError IABBedRemap::Serialize(std::ostream &outStream)
+	// IABBedRemap::SerializePayload() implementation
+	iabError IABBedRemap::SerializePayload(IABSerializeBuffer& ioBuffer)
 	{
-		// Check if "this" element is included in packing. If not, simply return with no further processing
-		if (!IsIncludedForPacking())
-		{
-			return kIABNoError;
-		}
-
-		// Set up payload writer and buffer
-		elementPayloadWriter_.align();										// reset writer byte alignment
-		elementPayloadBuffer_.seekp(0, std::ios::beg);						// reset internal payload buffer
-		elementPayloadBuffer_.clear();
-		elementHeadBuffer_.seekp(0, std::ios::beg);
-		elementHeadBuffer_.clear();
+		// Payload is appended to ioBuffer, see SerializeElement()
+		StreamWriter& payloadWriter = ioBuffer.GetWriter();
 
-		// Writing data fields (These are currently written into internal "elementPayloadBuffer_")
+		// Writing data fields
 		// Calling method for writing Plex encoded field.
-		write(elementPayloadWriter_, Plex<8>(metadataID_));
-		elementPayloadWriter_.write(static_cast<uint8_t>(remapUseCase_), 8);
-		write(elementPayloadWriter_, Plex<4>(sourceChannels_));
-		write(elementPayloadWriter_, Plex<4>(destinationChannels_));
+		write(payloadWriter, Plex<8>(metadataID_));
+		payloadWriter.write(static_cast<uint8_t>(remapUseCase_), 8);
+		write(payloadWriter, Plex<4>(sourceChannels_));
+		write(payloadWriter, Plex<4>(destinationChannels_));
 
 		// Stop writing if any is 0
 		if ((sourceChannels_ == 0) || (destinationChannels_ == 0) || (numRemapSubBlocks_ == 0))
@@ -4278,42 +5313,27 @@ namespace ImmersiveAudioBitstream
 		// Serialize all remap sub blocks, in sequence, into payload writer
 
 		// First block, skip "panInfoExists_" and always write panning parameters
-		bedRemapSubBlocks_[0]->SerializeSubBlock(elementPayloadWriter_);
+		bedRemapSubBlocks_[0]->SerializeSubBlock(payloadWriter);
 
 		for (uint8_t i = 1; i < numRemapSubBlocks_; i++)
 		{
-			bedRemapSubBlocks_[i]->Serialize(elementPayloadWriter_);
+			bedRemapSubBlocks_[i]->Serialize(payloadWriter);
 		}
 
 		// Align to byte after writing remap sub blocks
-		elementPayloadWriter_.align();										// Align to byte
+		payloadWriter.align();										// Align to byte
 
 		// Write "Reserved" which is hard set to "0" per specification (v4.34 of Dec 15, 2017), using Plex(8)
-		// (This is a strange one, to write a hard coded "0" with Plex(8). Will send questo reflector.)
-		// !! To be followed up
-		write(elementPayloadWriter_, Plex<8>(0));
-
-		// Get buffer length as payload, and set element size
-		IABElementSizeType packedPayloadLength = 0;
-		packedPayloadLength = static_cast<IABElementSizeType>(elementPayloadBuffer_.tellp());
-		SetElementSize(packedPayloadLength);
-
-		// Serialize frame head
-		SerializeHead();
-
-		// Output elementHeadBuffer_ first, followed by elementPayloadBuffer_
-		outStream << elementHeadBuffer_.rdbuf();
-		outStream << elementPayloadBuffer_.rdbuf();
-
-		// Clear stream contents after packing
-		elementHeadBuffer_.str("");
-		elementPayloadBuffer_.str("");
+		// (This is a strange one, to write a hard coded "0" with Plex(8). Will send questo reflector.)
+		// !! To be followed up
+		write(payloadWriter, Plex<8>(0));
 
 		return kIABNoError;
 	}
 
 	// IABBedRemap::DeSerialize() implementation
-	iabError IABBedRemap::DeSerialize(StreamReader& streamReader)
+	template<typename ReaderType>
+	iabError IABBedRemap::DeSerializeElement(ReaderType& streamReader)
 	{
         iabError errorCode = kIABNoError;
         
@@ -4428,6 +5448,16 @@ namespace ImmersiveAudioBitstream
 		}
 	}
 
+	iabError IABBedRemap::DeSerialize(StreamReader& streamReader)
+	{
+		return DeSerializeElement(streamReader);
+	}
+
+	iabError IABBedRemap::DeSerialize(BufferReader& streamReader)
+	{
+		return DeSerializeElement(streamReader);
+	}
+
     // IABBedRemap::Validate() implementation
     bool IABBedRemap::Validate(IABEventHandler &iEvenHandler, ValidationIssue &iValidationIssue) const
     {
@@ -4733,7 +5763,7 @@ namespace ImmersiveAudioBitstream
 		// ObjectDefinition element, without alignment manipulation
 		// ! Do not change alignment when writing individual sub blocks.
 
-		// Writing data fields (These are currently written into internal "elementPayloadBuffer_")
+		// Writing data fields
 		streamWriter.write(panInfoExists_, 1);
 
 		if (panInfoExists_ == 1)
@@ -4752,7 +5782,7 @@ namespace ImmersiveAudioBitstream
 		// ObjectDefinition element, without alignment manipulation
 		// ! Do not change alignment when writing individual sub blocks.
 
-		// Writing data fields (These are currently written into internal "elementPayloadBuffer_")
+		// Writing data fields
 
 		// For first pan sub block, panInfoExists_ is always 1 by specification. It is not in bitstream.
 		// Writing object panning parameters specified for the block.
@@ -4842,7 +5872,8 @@ namespace ImmersiveAudioBitstream
 	}
 
 	// IABObjectSubBlock::DeSerialize() implementation
-	iabError IABObjectSubBlock::DeSerialize(StreamReader& streamReader)
+	template<typename ReaderType>
+	iabError IABObjectSubBlock::DeSerializeElement(ReaderType& streamReader)
 	{
 		iabError errorCode = kIABNoError;
         uint8_t fixedLengthField = 0;
@@ -4863,8 +5894,19 @@ namespace ImmersiveAudioBitstream
 		return errorCode;
 	}
 
+	iabError IABObjectSubBlock::DeSerialize(StreamReader& streamReader)
+	{
+		return DeSerializeElement(streamReader);
+	}
+
+	iabError IABObjectSubBlock::DeSerialize(BufferReader& streamReader)
+	{
+		return DeSerializeElement(streamReader);
+	}
+
 	// IABObjectSubBlock::DeSerializeSubBlock() implementation
-	iabError IABObjectSubBlock::DeSerializeSubBlock(StreamReader& streamReader)
+	template<typename ReaderType>
+	iabError IABObjectSubBlock::DeSerializeSubBlock(ReaderType& streamReader)
 	{
         uint8_t fixedLengthFieldMax8 = 0;
         uint16_t fixedLengthFieldMax16 = 0;
@@ -5857,6 +6899,12 @@ namespace ImmersiveAudioBitstream
 	// IABObjectDefinition::ClearSubElements() implementation
 	iabError IABObjectDefinition::ClearSubElements()
 	{
+		// Elements allocated from the frame arena are released with the frame
+		if (HasArenaAllocatedElement(objectSubElements_))
+		{
+			return kIABNotImplementedError;
+		}
+
 		objectSubElements_.clear();
 		subElementCount_ = 0;
 
@@ -5901,6 +6949,13 @@ namespace ImmersiveAudioBitstream
 			// Find the matching entry from the list...
 			if (iSubElement == *iter)
 			{
+				// Elements allocated from the frame arena are released with the frame
+				if (IABFrameArenaObject::IsArenaAllocated(dynamic_cast<const void*>(iSubElement)))
+				{
+					errorCode = kIABNotImplementedError;
+					break;
+				}
+
 				// Erase the entry from list (but not delete *iter).
 				objectSubElements_.erase(iter);
 
@@ -5972,100 +7027,76 @@ namespace ImmersiveAudioBitstream
 		return IABElement::IsIncludedForPacking();
 	}
 
-	// IABObjectDefinition::Serialize() implementation
-	iabError IABObjectDefinition::Serialize(std::ostream &outStream)
+	// IABObjectDefinition::SerializePayload() implementation
+	iabError IABObjectDefinition::SerializePayload(IABSerializeBuffer& ioBuffer)
 	{
-		// Check if "this" element is included in packing. If not, simply return with no further processing
-		if (!IsIncludedForPacking())
-		{
-			return kIABNoError;
-		}
-		else
-		{
-			// Yes, included. Update sub element count for sub element packing
-			UpdatePackingEnabledSubElementCount();
-		}
+		// Update sub element count for sub element packing
+		UpdatePackingEnabledSubElementCount();
 
-		// Set up payload writer and buffer
-		elementPayloadWriter_.align();										// reset writer byte alignment
-		elementPayloadBuffer_.seekp(0, std::ios::beg);						// reset internal payload buffer
-		elementPayloadBuffer_.clear();
-		elementHeadBuffer_.seekp(0, std::ios::beg);
-		elementHeadBuffer_.clear();
+		// Payload is appended to ioBuffer, see SerializeElement()
+		StreamWriter& payloadWriter = ioBuffer.GetWriter();
 
 
-		// Writing data fields (These are currently written into internal "elementPayloadBuffer_")
+		// Writing data fields
 		// Calling method for writing Plex encoded field.
-		write(elementPayloadWriter_, Plex<8>(metadataID_));
-		write(elementPayloadWriter_, Plex<8>(audioDataID_));
+		write(payloadWriter, Plex<8>(metadataID_));
+		write(payloadWriter, Plex<8>(audioDataID_));
 
-		elementPayloadWriter_.write(conditionalObject_, 1);
+		payloadWriter.write(conditionalObject_, 1);
 		if (conditionalObject_ == 1)
 		{
-			elementPayloadWriter_.write(reserved1_, 1);						// A reserved 1-bit fired, always = 1
-			elementPayloadWriter_.write(static_cast<uint8_t>(objectUseCase_), 8);
+			payloadWriter.write(reserved1_, 1);						// A reserved 1-bit fired, always = 1
+			payloadWriter.write(static_cast<uint8_t>(objectUseCase_), 8);
 		}
 
-		elementPayloadWriter_.write(reserved2_, 1);							// A reserved 1-bit fired, always = 0
+		payloadWriter.write(reserved2_, 1);							// A reserved 1-bit fired, always = 0
 
 		// numPanSubBlocks_ is not in the stream, but is determined by frame rate, per spec
 
 		// Serialize all object pan sub blocks, in sequence, into payload writer
 
 		// First block, skip "panInfoExists_" and always write panning parameters
-		objectPanSubBlocks_[0]->SerializeSubBlock(elementPayloadWriter_);
+		objectPanSubBlocks_[0]->SerializeSubBlock(payloadWriter);
 
 		// For remaining sub-blocks, call serialization that packs the "panInfoExists_" at beginning
 		for (uint8_t i = 1; i < numPanSubBlocks_; i++)
 		{
-			objectPanSubBlocks_[i]->Serialize(elementPayloadWriter_);
+			objectPanSubBlocks_[i]->Serialize(payloadWriter);
 		}
 
-		elementPayloadWriter_.align();										// Align to byte
+		payloadWriter.align();										// Align to byte
 
-		elementPayloadWriter_.write(static_cast<uint8_t>(audioDescription_.audioDescription_), 8);
+		payloadWriter.write(static_cast<uint8_t>(audioDescription_.audioDescription_), 8);
 
 		if (audioDescription_.audioDescription_ & 0x80)
 		{
             // Write audio description text to bitstream as a null terminated string (i.e. character sequence)
             // writeStringAppendNull() will add a null byte after the last character of the string.
-            writeStringAppendNull(elementPayloadWriter_, audioDescription_.audioDescriptionText_);
+            writeStringAppendNull(payloadWriter, audioDescription_.audioDescriptionText_);
 		}
 
-		write(elementPayloadWriter_, Plex<8>(packedSubElementCount_));		// Note to write packedSubElementCount_ instead of subElementCount_
-		// Serialize all sub-elements, in sequence
-		// Append to end of IABObjectDefinition's "elementPayloadBuffer_"
+		write(payloadWriter, Plex<8>(packedSubElementCount_));		// Note to write packedSubElementCount_ instead of subElementCount_
+		// Serialize all sub-elements, in sequence, after the object definition payload
 		for (IABElementCountType i = 0; i < subElementCount_; i++)			// Still loop through all subElementCount_ of sub elements
 		{
-			// Temp StringStream to hold packed output from sub-elements (TODO: optimization?)
-			std::stringstream subElementPayload(std::stringstream::in | std::stringstream::out | std::stringstream::binary);
-			objectSubElements_[i]->Serialize(subElementPayload);
-			const std::string payLoad = subElementPayload.str();
-			uint32_t length = static_cast<uint32_t>(payLoad.size());
-			elementPayloadWriter_.write((uint8_t*)payLoad.data(), length);
-		}
-
-		// Get buffer length as payload, and set element size
-		IABElementSizeType packedPayloadLength = 0;
-		packedPayloadLength = static_cast<IABElementSizeType>(elementPayloadBuffer_.tellp());
-		SetElementSize(packedPayloadLength);
-
-		// Serialize frame head
-		SerializeHead();
-
-		// Output elementHeadBuffer_ first, followed by elementPayloadBuffer_
-		outStream << elementHeadBuffer_.rdbuf();
-		outStream << elementPayloadBuffer_.rdbuf();
+			// Sub-element head and payload follow in place. One that fails to serialize fails this element.
+			if (objectSubElements_[i]->IsIncludedForPacking())
+			{
+				iabError errorCode = objectSubElements_[i]->SerializeElement(ioBuffer);
 
-		// Clear stream contents after packing
-		elementHeadBuffer_.str("");
-		elementPayloadBuffer_.str("");
+				if (errorCode != kIABNoError)
+				{
+					return errorCode;
+				}
+			}
+		}
 
 		return kIABNoError;
 	}
 
 	// IABObjectDefinition::DeSerialize() implementation
-	iabError IABObjectDefinition::DeSerialize(StreamReader& streamReader)
+	template<typename ReaderType>
+	iabError IABObjectDefinition::DeSerializeElement(ReaderType& streamReader)
 	{
 		iabError errorCode = kIABNoError;
 
@@ -6224,9 +7255,42 @@ namespace ImmersiveAudioBitstream
             return kIABParserIABObjectDefinitionError;
         }
 	}
+
+	iabError IABObjectDefinition::DeSerialize(StreamReader& streamReader)
+	{
+		return DeSerializeElement(streamReader);
+	}
+
+	iabError IABObjectDefinition::DeSerialize(BufferReader& streamReader)
+	{
+		return DeSerializeElement(streamReader);
+	}
+
+	// IABObjectDefinition::ResetForReuse() implementation
+	void IABObjectDefinition::ResetForReuse()
+	{
+		IABElement::ResetForReuse();
+
+		DeletePanSubBlocks();
+		DeleteSubElements();
+
+		metadataID_ = 0;
+		audioDataID_ = 0;
+		conditionalObject_ = 0;
+		objectUseCase_ = kIABUseCase_7_1_DS;
+		numPanSubBlocks_ = GetIABNumSubBlocks(parentFrameRate_);
+		audioDescription_.audioDescription_ = kIABAudioDescription_NotIndicated;
+		audioDescription_.audioDescriptionText_.clear();
+		numSkippedObjectSubElementsInParsing_ = 0;
+		numUndefinedObjectSubElements_ = 0;
+		numUnallowedObjectSubElements_ = 0;
+
+		packedSubElementCount_ = 0;
+	}
     
 	// IABObjectDefinition::ParseObjectSubElement() implementation
-	iabError IABObjectDefinition::ParseObjectSubElement(StreamReader& streamReader)
+	template<typename ReaderType>
+	iabError IABObjectDefinition::ParseObjectSubElement(ReaderType& streamReader)
     {
 		uint32_t parsedElementIDField;
 		IABElementIDType elementID;
@@ -6260,7 +7324,7 @@ namespace ImmersiveAudioBitstream
 			case kIABElementID_AudioDataDLC:
 			case kIABElementID_AudioDataPCM:
 			case kIABElementID_IAFrame:
-				SkipDeSerializeCurrentElement(*elementReader_);
+				SkipDeSerializeCurrentElement(streamReader);
 				numSkippedObjectSubElementsInParsing_++;
 				numUnallowedObjectSubElements_++;
 				return kIABNoError;										// Exit, as objectDefinitionSubElement == nullptr for this case
@@ -6268,7 +7332,7 @@ namespace ImmersiveAudioBitstream
 			// Undefined/Unknown type as IAB ObjectDefinition sub-element
 			// Total number of unallowed element IDs for the object is tracked in numUndefinedObjectSubElements_.
 			default:
-				SkipDeSerializeCurrentElement(*elementReader_);
+				SkipDeSerializeCurrentElement(streamReader);
 				numSkippedObjectSubElementsInParsing_++;
 				numUndefinedObjectSubElements_++;
 				return kIABNoError;										// Exit, as objectDefinitionSubElement == nullptr for default case
@@ -6777,7 +7841,7 @@ namespace ImmersiveAudioBitstream
 		// IABObjectZoneDefinition19 element, without alignment manipulation
 		// ! Do not change alignment when writing individual sub blocks.
 
-		// Writing data fields (These are currently written into internal "elementPayloadBuffer_")
+		// Writing data fields
 		streamWriter.write(zone19Gain_.objectZone19InfoExists_, 1);
 
 		if (zone19Gain_.objectZone19InfoExists_ == 1)
@@ -6791,7 +7855,7 @@ namespace ImmersiveAudioBitstream
 	// IABZone19SubBlock::SerializeSubBlock() implementation
 	iabError IABZone19SubBlock::SerializeSubBlock(StreamWriter& streamWriter)
 	{
-		// Writing data fields (These are currently written into internal "elementPayloadBuffer_")
+		// Writing data fields
 
 		// For first zone19 sub block, zone19Gain_.objectZone19InfoExists_ is always 1 by specification. 
 		// It is not in bitstream.
@@ -6810,7 +7874,8 @@ namespace ImmersiveAudioBitstream
 	}
 
 	// IABZone19SubBlock::DeSerialize() implementation
-	iabError IABZone19SubBlock::DeSerialize(StreamReader& streamReader)
+	template<typename ReaderType>
+	iabError IABZone19SubBlock::DeSerializeElement(ReaderType& streamReader)
 	{
 		iabError errorCode = kIABNoError;
 		uint8_t fixedLengthFieldMax8 = 0;
@@ -6831,8 +7896,19 @@ namespace ImmersiveAudioBitstream
 		return errorCode;
 	}
 
+	iabError IABZone19SubBlock::DeSerialize(StreamReader& streamReader)
+	{
+		return DeSerializeElement(streamReader);
+	}
+
+	iabError IABZone19SubBlock::DeSerialize(BufferReader& streamReader)
+	{
+		return DeSerializeElement(streamReader);
+	}
+
 	// IABZone19SubBlock::DeSerializeSubBlock() implementation
-	iabError IABZone19SubBlock::DeSerializeSubBlock(StreamReader& streamReader)
+	template<typename ReaderType>
+	iabError IABZone19SubBlock::DeSerializeSubBlock(ReaderType& streamReader)
 	{
 		uint8_t fixedLengthFieldMax8 = 0;
 		uint16_t fixedLengthFieldMax16 = 0;
@@ -7044,61 +8120,36 @@ namespace ImmersiveAudioBitstream
 		return IABElement::IsIncludedForPacking();
 	}
 
-	// IABObjectZoneDefinition19::Serialize() implementation
-	iabError IABObjectZoneDefinition19::Serialize(std::ostream &outStream)
+	// IABObjectZoneDefinition19::SerializePayload() implementation
+	iabError IABObjectZoneDefinition19::SerializePayload(IABSerializeBuffer& ioBuffer)
 	{
-		// Check if "this" element is included in packing. If not, simply return with no further processing
-		if (!IsIncludedForPacking())
-		{
-			return kIABNoError;
-		}
-
-		// Set up payload writer and buffer
-		elementPayloadWriter_.align();										// reset writer byte alignment
-		elementPayloadBuffer_.seekp(0, std::ios::beg);						// reset internal payload buffer
-		elementPayloadBuffer_.clear();
-		elementHeadBuffer_.seekp(0, std::ios::beg);
-		elementHeadBuffer_.clear();
+		// Payload is appended to ioBuffer, see SerializeElement()
+		StreamWriter& payloadWriter = ioBuffer.GetWriter();
 
 		// numZone19SubBlocks_ is not in the stream, but is determined by frame rate, per spec
 
 		// Serialize all zone19 sub blocks, in sequence, into payload writer
 		// First block, call "SerializeSubBlock()" directly
-		zone19SubBlocks_[0]->SerializeSubBlock(elementPayloadWriter_);
+		zone19SubBlocks_[0]->SerializeSubBlock(payloadWriter);
 
 		// For remaining zone19 sub-blocks, call "Serialize()"
 		for (uint8_t i = 1; i < numZone19SubBlocks_; i++)
 		{
-			zone19SubBlocks_[i]->Serialize(elementPayloadWriter_);
+			zone19SubBlocks_[i]->Serialize(payloadWriter);
 		}
 
 		// Current specificaion v4.34 does not require alingment post Zone19?
 		// Strongly suggest to add alignment to 25CSS group
 		// I am adding alignment in anticipation, as not having it would
 		// mean that DLC element may not be byte aligned, causing issues!
-		elementPayloadWriter_.align();										// Align to byte
-
-		// Get buffer length as payload, and set element size
-		IABElementSizeType packedPayloadLength = 0;
-		packedPayloadLength = static_cast<IABElementSizeType>(elementPayloadBuffer_.tellp());
-		SetElementSize(packedPayloadLength);
-
-		// Serialize frame head
-		SerializeHead();
-
-		// Output elementHeadBuffer_ first, followed by elementPayloadBuffer_
-		outStream << elementHeadBuffer_.rdbuf();
-		outStream << elementPayloadBuffer_.rdbuf();
-
-		// Clear stream contents after packing
-		elementHeadBuffer_.str("");
-		elementPayloadBuffer_.str("");
+		payloadWriter.align();										// Align to byte
 
 		return kIABNoError;
 	}
 
 	// IABObjectZoneDefinition19::DeSerialize() implementation
-	iabError IABObjectZoneDefinition19::DeSerialize(StreamReader& streamReader)
+	template<typename ReaderType>
+	iabError IABObjectZoneDefinition19::DeSerializeElement(ReaderType& streamReader)
 	{
         iabError errorCode = kIABNoError;
         
@@ -7164,6 +8215,16 @@ namespace ImmersiveAudioBitstream
             return kIABParserIABObjectZone19Error;
         }
 	}
+
+	iabError IABObjectZoneDefinition19::DeSerialize(StreamReader& streamReader)
+	{
+		return DeSerializeElement(streamReader);
+	}
+
+	iabError IABObjectZoneDefinition19::DeSerialize(BufferReader& streamReader)
+	{
+		return DeSerializeElement(streamReader);
+	}
     
     // IABObjectZoneDefinition19::Validate() implementation
     bool IABObjectZoneDefinition19::Validate(IABEventHandler &iEvenHandler, ValidationIssue &iValidationIssue) const
@@ -7296,47 +8357,22 @@ namespace ImmersiveAudioBitstream
 		return IABElement::IsIncludedForPacking();
 	}
 
-	// IABAuthoringToolInfo::Serialize() implementation
-	iabError IABAuthoringToolInfo::Serialize(std::ostream &outStream)
+	// IABAuthoringToolInfo::SerializePayload() implementation
+	iabError IABAuthoringToolInfo::SerializePayload(IABSerializeBuffer& ioBuffer)
 	{
-		// Check if "this" element is included in packing. If not, simply return with no further processing
-		if (!IsIncludedForPacking())
-		{
-			return kIABNoError;
-		}
-
-		// Set up payload writer and buffer
-		elementPayloadWriter_.align();										// reset writer byte alignment
-		elementPayloadBuffer_.seekp(0, std::ios::beg);						// reset internal payload buffer
-		elementPayloadBuffer_.clear();
-		elementHeadBuffer_.seekp(0, std::ios::beg);
-		elementHeadBuffer_.clear();
+		// Payload is appended to ioBuffer, see SerializeElement()
+		StreamWriter& payloadWriter = ioBuffer.GetWriter();
 
         // Write authoring tool info to bitstream as a null terminated string (i.e. character sequence)
         // writeStringAppendNull() will add a null byte after the last character of the string.
-        writeStringAppendNull(elementPayloadWriter_, authoringToolURI_);
-
-		// Get buffer length as payload, and set element size
-		IABElementSizeType packedPayloadLength = 0;
-		packedPayloadLength = static_cast<IABElementSizeType>(elementPayloadBuffer_.tellp());
-		SetElementSize(packedPayloadLength);
-
-		// Serialize frame head
-		SerializeHead();
-
-		// Output elementHeadBuffer_ first, followed by elementPayloadBuffer_
-		outStream << elementHeadBuffer_.rdbuf();
-		outStream << elementPayloadBuffer_.rdbuf();
-
-		// Clear stream contents after packing
-		elementHeadBuffer_.str("");
-		elementPayloadBuffer_.str("");
+        writeStringAppendNull(payloadWriter, authoringToolURI_);
 
 		return kIABNoError;
 	}
 
 	// IABAuthoringToolInfo::DeSerialize() implementation
-	iabError IABAuthoringToolInfo::DeSerialize(StreamReader& streamReader)
+	template<typename ReaderType>
+	iabError IABAuthoringToolInfo::DeSerializeElement(ReaderType& streamReader)
 	{
 		iabError errorCode = kIABNoError;
 		std::vector<uint8_t> parsedBytes;
@@ -7360,6 +8396,24 @@ namespace ImmersiveAudioBitstream
 		}
 	}
 
+	iabError IABAuthoringToolInfo::DeSerialize(StreamReader& streamReader)
+	{
+		return DeSerializeElement(streamReader);
+	}
+
+	iabError IABAuthoringToolInfo::DeSerialize(BufferReader& streamReader)
+	{
+		return DeSerializeElement(streamReader);
+	}
+
+	// IABAuthoringToolInfo::ResetForReuse() implementation
+	void IABAuthoringToolInfo::ResetForReuse()
+	{
+		IABElement::ResetForReuse();
+
+		authoringToolURI_.clear();
+	}
+
     // IABAuthoringToolInfo::Validate() implementation
     bool IABAuthoringToolInfo::Validate(IABEventHandler &iEvenHandler, ValidationIssue &iValidationIssue) const
     {
@@ -7486,50 +8540,25 @@ namespace ImmersiveAudioBitstream
 		return IABElement::IsIncludedForPacking();
 	}
 
-	// IABUserData::Serialize() implementation
-	iabError IABUserData::Serialize(std::ostream &outStream)
+	// IABUserData::SerializePayload() implementation
+	iabError IABUserData::SerializePayload(IABSerializeBuffer& ioBuffer)
 	{
-		// Check if "this" element is included in packing. If not, simply return with no further processing
-		if (!IsIncludedForPacking())
-		{
-			return kIABNoError;
-		}
-
-		// Set up payload writer and buffer
-		elementPayloadWriter_.align();										// reset writer byte alignment
-		elementPayloadBuffer_.seekp(0, std::ios::beg);						// reset internal payload buffer
-		elementPayloadBuffer_.clear();
-		elementHeadBuffer_.seekp(0, std::ios::beg);
-		elementHeadBuffer_.clear();
+		// Payload is appended to ioBuffer, see SerializeElement()
+		StreamWriter& payloadWriter = ioBuffer.GetWriter();
 
 		// Write user ID
-		elementPayloadWriter_.write(&userID_[0], 16);						// 16 bytes
+		payloadWriter.write(&userID_[0], 16);						// 16 bytes
 
 		// Expect size of user data block does not exceed 32-bit range
 		uint32_t userDataSize = static_cast<uint32_t>(userDataBytes_.size());
-		elementPayloadWriter_.write(&userDataBytes_[0], userDataSize);		// write user data
-
-		// Get buffer length as payload, and set element size
-		IABElementSizeType packedPayloadLength = 0;
-		packedPayloadLength = static_cast<IABElementSizeType>(elementPayloadBuffer_.tellp());
-		SetElementSize(packedPayloadLength);
-
-		// Serialize frame head
-		SerializeHead();
-
-		// Output elementHeadBuffer_ first, followed by elementPayloadBuffer_
-		outStream << elementHeadBuffer_.rdbuf();
-		outStream << elementPayloadBuffer_.rdbuf();
-
-		// Clear stream contents after packing
-		elementHeadBuffer_.str("");
-		elementPayloadBuffer_.str("");
+		ioBuffer.WriteBytes(&userDataBytes_[0], userDataSize);		// write user data
 
 		return kIABNoError;
 	}
 
 	// IABUserData::DeSerialize() implementation
-	iabError IABUserData::DeSerialize(StreamReader& streamReader)
+	template<typename ReaderType>
+	iabError IABUserData::DeSerializeElement(ReaderType& streamReader)
 	{
 		iabError errorCode = kIABNoError;
 
@@ -7573,6 +8602,25 @@ namespace ImmersiveAudioBitstream
 			return kIABParserIABUserDataError;
 		}
 	}
+
+	iabError IABUserData::DeSerialize(StreamReader& streamReader)
+	{
+		return DeSerializeElement(streamReader);
+	}
+
+	iabError IABUserData::DeSerialize(BufferReader& streamReader)
+	{
+		return DeSerializeElement(streamReader);
+	}
+
+	// IABUserData::ResetForReuse() implementation
+	void IABUserData::ResetForReuse()
+	{
+		IABElement::ResetForReuse();
+
+		userDataBytes_.clear();
+		memset(userID_, 0, sizeof(userID_));
+	}
     
     // IABUserData::Validate() implementation
    bool IABUserData::Validate(IABEventHandler &iEvenHandler, ValidationIssue &iValidationIssue) const
@@ -7636,20 +8684,16 @@ namespace ImmersiveAudioBitstream
 		DLCSize_ = 0;
 		frameRateCode_ = iFrameRateCode;
 		DLCSampleRate_ = dlc::eSampleRate_48000;
-		decodedPCM_ = nullptr;
+		dlcSimpleEncoder96k_ = nullptr;
+		dlcCodecContext_ = nullptr;
+		lazyPayload_ = nullptr;
+		lazyPayloadSize_ = 0;
 
-		// Set up DLC subblock
+		// Set up DLC subblock. This also checks that DLC supports the frame rate.
 		if (SetupDLCSubblock() != kIABNoError)
 		{
 			oConstructionReturnError = kIABElementDLCMalConstructedError;
 		}
-
-		// Set up simple encoder
-		if (dlcSimpleEncoder_.setup(DLCSampleRate_, static_cast<dlc::FrameRate>(frameRateCode_))
-			!= dlc::SimpleEncoder::StatusCode_OK)
-		{
-			oConstructionReturnError = kIABElementDLCMalConstructedError;
-		}
 	}
 
 	IABAudioDataDLC::IABAudioDataDLC(IABFrameRateType iFrameRateCode
@@ -7662,7 +8706,10 @@ namespace ImmersiveAudioBitstream
 		audioDataID_ = 0;
 		DLCSize_ = 0;
 		frameRateCode_ = iFrameRateCode;
-		decodedPCM_ = nullptr;
+		dlcSimpleEncoder96k_ = nullptr;
+		dlcCodecContext_ = nullptr;
+		lazyPayload_ = nullptr;
+		lazyPayloadSize_ = 0;
 		
 		// Set up DLC subblock
 		if (SetupDLCSubblock() != kIABNoError)
@@ -7670,7 +8717,7 @@ namespace ImmersiveAudioBitstream
 			oConstructionReturnError = kIABElementDLCMalConstructedError;
 		}
 
-		// Set up DLCSampleRate_. This call also sets up dlcSimpleEncoder_
+		// Set up DLCSampleRate_
 		if (SetDLCSampleRate(iSampleRate) != kIABNoError)
 		{
 			oConstructionReturnError = kIABElementDLCMalConstructedError;
@@ -7680,7 +8727,26 @@ namespace ImmersiveAudioBitstream
 	// Destructor
 	IABAudioDataDLC::~IABAudioDataDLC()
 	{
-		delete[] decodedPCM_;
+		delete dlcSimpleEncoder96k_;
+		delete dlcCodecContext_;
+	}
+
+	// IABAudioDataDLC::GetDLCCodecContext() implementation
+	IABDLCCodecContext* IABAudioDataDLC::GetDLCCodecContext()
+	{
+		IABDLCCodecContext* context = IABDLCCodecContext::GetCurrent();
+
+		if (context)
+		{
+			return context;
+		}
+
+		if (!dlcCodecContext_)
+		{
+			dlcCodecContext_ = new IABDLCCodecContext();
+		}
+
+		return dlcCodecContext_;
 	}
 
 	// IABAudioDataDLC::GetAudioDataID() implementation
@@ -7745,12 +8811,9 @@ namespace ImmersiveAudioBitstream
 			return kIABGeneralError;
 		}
 
-		// Set up (reset) simple encoder to updated sample rate.
-		if (dlcSimpleEncoder_.setup(DLCSampleRate_, static_cast<dlc::FrameRate>(frameRateCode_))
-			!= dlc::SimpleEncoder::StatusCode_OK)
-		{
-			return kIABGeneralError;
-		}
+		// Reset 96 kHz encoder, it is set up again on the next 96 kHz encoding
+		delete dlcSimpleEncoder96k_;
+		dlcSimpleEncoder96k_ = nullptr;
 
 		return kIABNoError;
 	}
@@ -7765,8 +8828,40 @@ namespace ImmersiveAudioBitstream
 			return kIABBadArgumentsError;
 		}
 
+		// Any payload kept from parsing is replaced
+		DropLazyPayload();
+
+		// The 96 kHz encoder belongs to the element. The 48 kHz encoder is borrowed from the codec context.
+		dlc::SimpleEncoder* encoder = nullptr;
+
+		if (DLCSampleRate_ == dlc::eSampleRate_96000)
+		{
+			if (!dlcSimpleEncoder96k_)
+			{
+				dlcSimpleEncoder96k_ = new dlc::SimpleEncoder();
+
+				if (dlcSimpleEncoder96k_->setup(DLCSampleRate_, static_cast<dlc::FrameRate>(frameRateCode_))
+					!= dlc::SimpleEncoder::StatusCode_OK)
+				{
+					delete dlcSimpleEncoder96k_;
+					dlcSimpleEncoder96k_ = nullptr;
+				}
+			}
+
+			encoder = dlcSimpleEncoder96k_;
+		}
+		else
+		{
+			encoder = GetDLCCodecContext()->GetEncoder48k(frameRateCode_);
+		}
+
+		if (!encoder)
+		{
+			return kIABPackerDLCError;
+		}
+
 		// Encode
-		encoderErrorCode = dlcSimpleEncoder_.encode_noexcept(iSamples, iSampleCount, DLCSampleRate_, audioData_);
+		encoderErrorCode = encoder->encode_noexcept(iSamples, iSampleCount, DLCSampleRate_, audioData_);
 
 		if (encoderErrorCode != dlc::SimpleEncoder::StatusCode_OK)
 		{
@@ -7797,56 +8892,46 @@ namespace ImmersiveAudioBitstream
 		return IABElement::IsIncludedForPacking();
 	}
 
-	// IABAudioDataDLC::Serialize() implementation
-	iabError IABAudioDataDLC::Serialize(std::ostream &outStream)
+	// IABAudioDataDLC::SerializePayload() implementation
+	iabError IABAudioDataDLC::SerializePayload(IABSerializeBuffer& ioBuffer)
 	{
-		// Check if "this" element is included in packing. If not, simply return with no further processing
-		if (!IsIncludedForPacking())
+		// A payload parsed lazily is packed from audioData_, parse it first
+		iabError errorCode = ParseLazyPayload();
+
+		if (errorCode != kIABNoError)
 		{
-			return kIABNoError;
+			return errorCode;
 		}
 
-		// uint32_t dlcOstreamPosition = 0;
-		// uint32_t packedDLCSizeInBytes = 0;
-		// dlcOstreamPosition = static_cast<IABElementSizeType>(elementPayloadBuffer_.tellp());
+		// Payload is appended to ioBuffer, see SerializeElement()
+		StreamWriter& payloadWriter = ioBuffer.GetWriter();
 
-		// since DLCSize can only be determined AFTER packing DLC payload, another internal 
-		// bitstream writer is needed, to accommodate another instance of non-sequential
-		// packing requirement.
-		std::stringstream	dlcHeadBuffer(std::stringstream::in | std::stringstream::out | std::stringstream::binary);
-		StreamWriter		dlcHeadWriter(dlcHeadBuffer);
-		// Both writer and buffer are in init state.
-        // TODO: Review XCode analyzer warning
-		write(dlcHeadWriter, Plex<8>(audioDataID_));						// AudioDataID, identifying this DLC element
+		// DLC head, AudioDataID identifying this DLC element, followed by DLCSize_
+		write(payloadWriter, Plex<8>(audioDataID_));
 
-		// "DLCSize_" is to be determined by "payload" size, to be determined and written below.
-		// (in the case of DLC element, it is actually "DLC payload" size".
-		// The element payload is the sum of DLC payload size and DLC head size.
+		// Since DLCSize_ can only be determined AFTER packing DLC payload, its 16-bit field is
+		// filled in afterwards, as for element heads.
+		uint64_t dlcSizePosition = ioBuffer.GetSize();
+		payloadWriter.write(DLCSize_, 16);
+		uint64_t dlcPayloadPosition = ioBuffer.GetSize();
 
-		// Set up payload writer and buffer
-		elementPayloadWriter_.align();										// reset writer byte alignment
-		elementPayloadBuffer_.seekp(0, std::ios::beg);						// reset internal payload buffer
-		elementPayloadBuffer_.clear();
-		elementHeadBuffer_.seekp(0, std::ios::beg);
-		elementHeadBuffer_.clear();
-
-		// Writing data fields (These are currently written into internal "elementPayloadBuffer_")
+		// Writing data fields
 		// Calling method for writing Plex encoded field.
-		elementPayloadWriter_.write(audioData_.getSampleRate(), 2);
-		elementPayloadWriter_.write(audioData_.getShiftBits(), 5);
+		payloadWriter.write(audioData_.getSampleRate(), 2);
+		payloadWriter.write(audioData_.getShiftBits(), 5);
 
 		// Prediction Region for 48 kHz
-		elementPayloadWriter_.write(audioData_.getNumPredRegions48(), 2);
+		payloadWriter.write(audioData_.getNumPredRegions48(), 2);
 
 		// 19/10/2017: getNumPredRegions48 probably == 0, for now.
 		for (uint8_t n = 0; n < audioData_.getNumPredRegions48(); n++)
 		{
-			elementPayloadWriter_.write(audioData_.getPredRegion48(n).getRegionLength(), 4);
-			elementPayloadWriter_.write(audioData_.getPredRegion48(n).getOrder(), 5);
+			payloadWriter.write(audioData_.getPredRegion48(n).getRegionLength(), 4);
+			payloadWriter.write(audioData_.getPredRegion48(n).getOrder(), 5);
 
 			for (uint8_t m = 1; m <= audioData_.getPredRegion48(n).getOrder(); m++)				// Changed on Dec 11, 2017 (Currently following C indexing, but spec says "m = 1; m <= order; m++". TODO: Need confirming with Pierre.)
 			{
-				elementPayloadWriter_.write(audioData_.getPredRegion48(n).getKCoeff()[m], 10);
+				payloadWriter.write(audioData_.getPredRegion48(n).getKCoeff()[m], 10);
 			}
 		}
 
@@ -7855,7 +8940,7 @@ namespace ImmersiveAudioBitstream
 
 		for (uint8_t n = 0; n < audioData_.getNumDLCSubBlocks(); n++)
 		{
-			elementPayloadWriter_.write(audioData_.getDLCSubBlock48(n)->getCodeType(), 1);
+			payloadWriter.write(audioData_.getDLCSubBlock48(n)->getCodeType(), 1);
 
 			// If encoded as PCM
 			if (audioData_.getDLCSubBlock48(n)->getCodeType() == dlc::eCodeType_PCM_CODE_TYPE)
@@ -7863,7 +8948,7 @@ namespace ImmersiveAudioBitstream
 				dlc::PCMResidualsSubBlock* pcmResidualsSubBlock = dynamic_cast<dlc::PCMResidualsSubBlock*>(audioData_.getDLCSubBlock48(n));
 
 				uint5_t residualBitDepth = pcmResidualsSubBlock->getBitDepth();
-				elementPayloadWriter_.write(residualBitDepth, 5);
+				payloadWriter.write(residualBitDepth, 5);
 
 				if (residualBitDepth != 0)
 				{
@@ -7887,10 +8972,10 @@ namespace ImmersiveAudioBitstream
 							residualSign = 1;
 						}
 
-						elementPayloadWriter_.write(residualMagnitude, residualBitDepth);		// Write the residual magnitude
+						payloadWriter.write(residualMagnitude, residualBitDepth);		// Write the residual magnitude
 						if (residualValue != 0)
 						{
-							elementPayloadWriter_.write(residualSign, 1);						// Only write sign if residual value is not 0
+							payloadWriter.write(residualSign, 1);						// Only write sign if residual value is not 0
 						}
 
 					}
@@ -7910,24 +8995,24 @@ namespace ImmersiveAudioBitstream
 		if (audioData_.getSampleRate() == dlc::eSampleRate_96000)
 		{
 			// Prediction Region for 96 kHz
-			elementPayloadWriter_.write(audioData_.getNumPredRegions96(), 2);
+			payloadWriter.write(audioData_.getNumPredRegions96(), 2);
 
 			// 19/10/2017: getNumPredRegions96 probably == 0, for now.
 			for (uint8_t n = 0; n < audioData_.getNumPredRegions96(); n++)
 			{
-				elementPayloadWriter_.write(audioData_.getPredRegion96(n).getRegionLength(), 4);
-				elementPayloadWriter_.write(audioData_.getPredRegion96(n).getOrder(), 5);
+				payloadWriter.write(audioData_.getPredRegion96(n).getRegionLength(), 4);
+				payloadWriter.write(audioData_.getPredRegion96(n).getOrder(), 5);
 
 				for (uint8_t m = 1; m <= audioData_.getPredRegion96(n).getOrder(); m++)				// Changed on Dec 11, 2017 (Currently following C indexing, but spec says "m = 1; m <= order; m++". TODO: Need confirming with Pierre.)
 				{
-					elementPayloadWriter_.write(audioData_.getPredRegion96(n).getKCoeff()[m], 10);
+					payloadWriter.write(audioData_.getPredRegion96(n).getKCoeff()[m], 10);
 				}
 			}
 
 			// Coded residual samples for 96kHz
 			for (uint8_t n = 0; n < audioData_.getNumDLCSubBlocks(); n++)
 			{
-				elementPayloadWriter_.write(audioData_.getDLCSubBlock96(n)->getCodeType(), 1);
+				payloadWriter.write(audioData_.getDLCSubBlock96(n)->getCodeType(), 1);
 
 				// If encoded as PCM
 				if (audioData_.getDLCSubBlock96(n)->getCodeType() == dlc::eCodeType_PCM_CODE_TYPE)
@@ -7935,7 +9020,7 @@ namespace ImmersiveAudioBitstream
 					dlc::PCMResidualsSubBlock* pcmResidualsSubBlock = dynamic_cast<dlc::PCMResidualsSubBlock*>(audioData_.getDLCSubBlock96(n));
 
 					uint5_t residualBitDepth = pcmResidualsSubBlock->getBitDepth();
-					elementPayloadWriter_.write(residualBitDepth, 5);
+					payloadWriter.write(residualBitDepth, 5);
 
 					if (residualBitDepth != 0)
 					{
@@ -7959,10 +9044,10 @@ namespace ImmersiveAudioBitstream
 								residualSign = 1;
 							}
 
-							elementPayloadWriter_.write(residualMagnitude, residualBitDepth);		// Write the residual magnitude
+							payloadWriter.write(residualMagnitude, residualBitDepth);		// Write the residual magnitude
 							if (residualValue != 0)
 							{
-								elementPayloadWriter_.write(residualSign, 1);						// Only write sign if residual value is not 0
+								payloadWriter.write(residualSign, 1);						// Only write sign if residual value is not 0
 							}
 
 						}
@@ -7977,33 +9062,16 @@ namespace ImmersiveAudioBitstream
 			}
 		}
 
-		elementPayloadWriter_.align();														// Align to byte
+		payloadWriter.align();														// Align to byte
 
 		// Now ready to retrieve and set DLCSize_.
-		DLCSize_ = static_cast<uint16_t>(elementPayloadBuffer_.tellp());
-		dlcHeadWriter.write(DLCSize_, 16);
-
-		// Retrieve DLC head length, part of Element payload length
-		IABElementSizeType packedPayloadLength = 0;
-		packedPayloadLength = static_cast<IABElementSizeType>(dlcHeadBuffer.tellp());
-		// Add element payload buffer length
-		packedPayloadLength += static_cast<IABElementSizeType>(elementPayloadBuffer_.tellp());
-		// The sum is the element payload length
-		SetElementSize(packedPayloadLength);
-
-		// Serialize frame head
-		SerializeHead();
-
-		// Output elementHeadBuffer_ first,
-		// followed then by dlcHeadBuffer
-		// and finally followed by elementPayloadBuffer_
-		outStream << elementHeadBuffer_.rdbuf();
-		outStream << dlcHeadBuffer.rdbuf();
-		outStream << elementPayloadBuffer_.rdbuf();
-
-		// Clear stream contents after packing
-		elementHeadBuffer_.str("");
-		elementPayloadBuffer_.str("");
+		uint64_t dlcPayloadEnd = ioBuffer.GetSize();
+		DLCSize_ = static_cast<uint16_t>(dlcPayloadEnd - dlcPayloadPosition);
+
+		uint8_t dlcSizeField[2];
+		dlcSizeField[0] = static_cast<uint8_t>(DLCSize_ >> 8);
+		dlcSizeField[1] = static_cast<uint8_t>(DLCSize_);
+		ioBuffer.WriteBytesAt(dlcSizePosition, dlcSizeField, 2);
 
 		return kIABNoError;
 	}
@@ -8052,45 +9120,46 @@ namespace ImmersiveAudioBitstream
 			return kIABParserDLCDecodingError;
 		}
 
-		// Allocate memory to hold decoded PCM samples, if not already
-		if (!decodedPCM_)
+		// Coded audio of an element parsed lazily is parsed on first decoding
+		iabError errorCode = ParseLazyPayload();
+
+		if (errorCode != kIABNoError)
 		{
-			// Allocate
-			decodedPCM_ = new int32_t[dlcNumPCMSamples];
+			return errorCode;
+		}
 
-			// decode to decodedPCM_
-			if (iDecodeSampleRate == kIABSampleRate_48000Hz)
-			{
-				decoderErrorCode = dlcFullDecoder_.decode_noexcept(decodedPCM_, dlcNumPCMSamples, dlc::eSampleRate_48000, audioData_);
-			}
-			else if (iDecodeSampleRate == kIABSampleRate_96000Hz)
-			{
-				decoderErrorCode = dlcFullDecoder_.decode_noexcept(decodedPCM_, dlcNumPCMSamples, dlc::eSampleRate_96000, audioData_);
-			}
-			else
-			{
-				return kIABParserDLCDecodingError;
-			}
+		// Borrow the decoder from the codec context
+		IABDLCCodecContext* context = GetDLCCodecContext();
 
-			if (decoderErrorCode != dlc::FullDecoder::StatusCode_OK)
-			{
-				return kIABParserDLCDecodingError;
-			}
+		// Decode to client buffer when all samples are requested, through the context buffer otherwise
+		int32_t* decodedPCM = (iSampleCount == dlcNumPCMSamples) ? iSamples : context->GetSampleBuffer(dlcNumPCMSamples);
+
+		if (iDecodeSampleRate == kIABSampleRate_48000Hz)
+		{
+			decoderErrorCode = context->GetDecoder().decode_noexcept(decodedPCM, dlcNumPCMSamples, dlc::eSampleRate_48000, audioData_);
+		}
+		else
+		{
+			decoderErrorCode = context->GetDecoder().decode_noexcept(decodedPCM, dlcNumPCMSamples, dlc::eSampleRate_96000, audioData_);
 		}
 
-		// Copy to client buffer
-		int32_t* srcPointer = decodedPCM_;
+		if (decoderErrorCode != dlc::FullDecoder::StatusCode_OK)
+		{
+			return kIABParserDLCDecodingError;
+		}
 
-		for (uint32_t i = 0; i < iSampleCount; i++)
+		// Copy to client buffer
+		if (decodedPCM != iSamples)
 		{
-			iSamples[i] = srcPointer[i];
+			std::copy(decodedPCM, decodedPCM + iSampleCount, iSamples);
 		}
         
         return kIABNoError;        
 	}
 
 	// IABAudioDataDLC::DeSerialize() implementation
-	iabError IABAudioDataDLC::DeSerialize(StreamReader& streamReader)
+	template<typename ReaderType>
+	iabError IABAudioDataDLC::DeSerializeElement(ReaderType& streamReader)
 	{
         if (kIABNoError != DeSerializeHead(streamReader))
         {
@@ -8102,7 +9171,94 @@ namespace ImmersiveAudioBitstream
         {
             return kIABParserIABDLCError;
         }
- 
+
+        DropLazyPayload();
+
+        if (kIABNoError != DeSerializeHeaderFields(streamReader))
+        {
+            return kIABParserIABDLCError;
+        }
+
+        return DeSerializeCodedAudio(streamReader);
+    }
+
+	// IABAudioDataDLC::DeSerializeLazy() implementation
+	template<typename ReaderType>
+	iabError IABAudioDataDLC::DeSerializeLazyElement(ReaderType& streamReader, bool iBorrowPayload)
+	{
+        if (kIABNoError != DeSerializeHead(streamReader))
+        {
+            return kIABParserIABDLCError;
+        }
+        
+        if ((kIABElementID_AudioDataDLC != elementID_) || (0 == elementSize_))
+        {
+            return kIABParserIABDLCError;
+        }
+
+        DropLazyPayload();
+
+        // Keep the payload, up to the element size, as it is. Parse its header fields from there.
+        lazyPayloadSize_ = static_cast<uint32_t>(elementSize_);
+
+        if (!iBorrowPayload || !BorrowBytes(streamReader, lazyPayloadSize_, lazyPayload_))
+        {
+            lazyPayloadCopy_.resize(lazyPayloadSize_);
+
+            if (OK != streamReader.read(&lazyPayloadCopy_[0], lazyPayloadSize_))
+            {
+                DropLazyPayload();
+                return kIABParserIABDLCError;
+            }
+
+            lazyPayload_ = &lazyPayloadCopy_[0];
+        }
+
+        BufferReader payloadReader(reinterpret_cast<const char*>(lazyPayload_), static_cast<BitCount_t>(lazyPayloadSize_));
+
+        if (kIABNoError != DeSerializeHeaderFields(payloadReader))
+        {
+            DropLazyPayload();
+            return kIABParserIABDLCError;
+        }
+
+        return kIABNoError;
+    }
+
+	// IABAudioDataDLC::ParseLazyPayload() implementation
+	iabError IABAudioDataDLC::ParseLazyPayload()
+	{
+        if (nullptr == lazyPayload_)
+        {
+            return kIABNoError;
+        }
+
+        BufferReader payloadReader(reinterpret_cast<const char*>(lazyPayload_), static_cast<BitCount_t>(lazyPayloadSize_));
+
+        iabError errorCode = DeSerializeHeaderFields(payloadReader);
+
+        if (kIABNoError == errorCode)
+        {
+            errorCode = DeSerializeCodedAudio(payloadReader);
+        }
+
+        DropLazyPayload();
+
+        return errorCode;
+    }
+
+	// IABAudioDataDLC::DropLazyPayload() implementation
+	void IABAudioDataDLC::DropLazyPayload()
+	{
+        lazyPayload_ = nullptr;
+        lazyPayloadSize_ = 0;
+        lazyPayloadCopy_.clear();
+    }
+
+	// IABAudioDataDLC::DeSerializeHeaderFields() implementation
+	template<typename ReaderType>
+	iabError IABAudioDataDLC::DeSerializeHeaderFields(ReaderType& streamReader)
+	{
         Plex<8> plex8Field = 0;
         uint16_t fixedLengthFieldMax16 = 0;
         uint8_t fixedLengthFieldMax8 = 0;
@@ -8149,6 +9305,15 @@ namespace ImmersiveAudioBitstream
 			return kIABParserIABDLCError;
 		}
 
+        return kIABNoError;
+    }
+
+	// IABAudioDataDLC::DeSerializeCodedAudio() implementation
+	template<typename ReaderType>
+	iabError IABAudioDataDLC::DeSerializeCodedAudio(ReaderType& streamReader)
+	{
+        uint16_t fixedLengthFieldMax16 = 0;
+        uint8_t fixedLengthFieldMax8 = 0;
         uint8_t shiftBits = 0;
         
         // Read 5-bit shift bit field
@@ -8243,42 +9408,9 @@ namespace ImmersiveAudioBitstream
                 // Set bit depth
                 pcmResidualsSubBlock->setBitDepth(bitDepth);
                 
-                uint32_t subBlockSize = pcmResidualsSubBlock->getSize();					// Get residual block size
-                int32_t* pResiduals = pcmResidualsSubBlock->getResiduals();					// Get pointer to beginning of residual samples
-                int32_t residualValue = 0;													// Residual value, as-is retrieved
-                uint8_t residualSign = 0;													// 1-bit sign, 0 == postive, 1 == negative
-                
-                for (uint32_t i = 0; i < subBlockSize; i++)
+                if (kIABNoError != DeSerializePCMResiduals(streamReader, pcmResidualsSubBlock))
                 {
-					if (bitDepth == 0)
-					{
-						residualValue = 0;
-					}
-					else
-                    {
-                        // Read residual
-                        if (OK != streamReader.read(residualValue, bitDepth))
-                        {
-                            return kIABParserIABDLCError;
-                        }
-                        
-                        if (residualValue != 0)
-                        {
-                            // Read sign bit
-                            if (OK != streamReader.read(residualSign, 1))
-                            {
-                                return kIABParserIABDLCError;
-                            }
-
-                            if (1 == residualSign)
-                            {
-                                // invert value
-                                residualValue *= -1;
-                            }
-                        }
-                    }
-
-                    *pResiduals++ = residualValue;
+                    return kIABParserIABDLCError;
                 }
             }
             // If encoded using Rice/Golomb entropy compression
@@ -8299,60 +9431,9 @@ namespace ImmersiveAudioBitstream
                 // Set remainder bits
                 riceResidualsSubBlock->setRiceRemBits(riceRemBits);
                 
-                uint32_t subBlockSize = riceResidualsSubBlock->getSize();					// Get residual block size
-                dlc::RiceResidual* pResiduals = riceResidualsSubBlock->getResiduals();		// Get pointer to beginning of residual samples
-                
-                for (uint32_t i = 0; i < subBlockSize; i++)
+                if (kIABNoError != DeSerializeRiceResiduals(streamReader, riceResidualsSubBlock))
                 {
-                    int32_t remainder = 0;                          // Residual value, as-is retrieved
-                    char residualSign = 1;							// 1-bit sign, 0 == postive (maps to 1 for DLC lib), 1 == negative (maps to -1 for DLC lib)
-                    int32_t quotient = 0;
-                    
-                    if (OK != streamReader.read(fixedLengthFieldMax8, 1))
-                    {
-                        return kIABParserIABDLCError;
-                    }
-
-                    while (1 == fixedLengthFieldMax8)
-                    {
-                        quotient++;
-                        if (OK != streamReader.read(fixedLengthFieldMax8, 1))
-                        {
-                            return kIABParserIABDLCError;
-                        }
-                    }
-
-					if (riceRemBits == 0)
-					{
-						remainder = 0;
-					}
-					else
-                    {
-                        // Read rice remainder
-                        if (OK != streamReader.read(remainder, riceRemBits))
-                        {
-                            return kIABParserIABDLCError;
-                        }
-                    }
-                    
-                    if ((remainder != 0) || (quotient > 0))
-                    {
-                        // Read sign bit, 0 maps to +1, 1 maps to -1
-                        if (OK != streamReader.read(fixedLengthFieldMax8, 1))
-                        {
-                            return kIABParserIABDLCError;
-                        }
-
-                        if (1 == fixedLengthFieldMax8)
-                        {
-                            residualSign = -1;
-                        }
-                    }
-                    
-                    // save residual
-                    pResiduals->setQuotient(quotient);
-                    pResiduals->setSign(residualSign);
-                    pResiduals++->setRemainder(remainder);
+                    return kIABParserIABDLCError;
                 }
             }
         }
@@ -8440,43 +9521,9 @@ namespace ImmersiveAudioBitstream
                     // Set bit depth
                     pcmResidualsSubBlock->setBitDepth(bitDepth);
                     
-                    uint32_t subBlockSize = pcmResidualsSubBlock->getSize();					// Get residual block size
-                    int32_t* pResiduals = pcmResidualsSubBlock->getResiduals();					// Get pointer to beginning of residual samples
-                    int32_t residualValue = 0;													// Residual value, as-is retrieved
-                    uint8_t residualSign = 0;													// 1-bit sign, 0 == postive, 1 == negative
-                    
-                    for (uint32_t i = 0; i < subBlockSize; i++)
+                    if (kIABNoError != DeSerializePCMResiduals(streamReader, pcmResidualsSubBlock))
                     {
-
-						if (bitDepth == 0)
-						{
-							residualValue = 0;
-						}
-						else
-						{
-							// Read residual
-							if (OK != streamReader.read(residualValue, bitDepth))
-                            {
-                                return kIABParserIABDLCError;
-                            }
-
-							if (residualValue != 0)
-							{
-								// Read sign bit
-								if (OK != streamReader.read(residualSign, 1))
-                                {
-                                    return kIABParserIABDLCError;
-                                }
-
-                                if (1 == residualSign)
-								{
-									// invert value
-									residualValue *= -1;
-								}
-							}
-						}
-
-                        *pResiduals++ = residualValue;
+                        return kIABParserIABDLCError;
                     }
                 }
                 // If encoded using Rice/Golomb entropy compression
@@ -8498,60 +9545,9 @@ namespace ImmersiveAudioBitstream
                     // Set remainder bits
                     riceResidualsSubBlock->setRiceRemBits(riceRemBits);
                     
-                    uint32_t subBlockSize = riceResidualsSubBlock->getSize();					// Get residual block size
-                    dlc::RiceResidual* pResiduals = riceResidualsSubBlock->getResiduals();		// Get pointer to beginning of residual samples
-                    
-                    for (uint32_t i = 0; i < subBlockSize; i++)
+                    if (kIABNoError != DeSerializeRiceResiduals(streamReader, riceResidualsSubBlock))
                     {
-                        int32_t remainder = 0;                          // Residual value, as-is retrieved
-                        char residualSign = 1;							// 1-bit sign, 0 == postive (maps to 1 for DLC lib), 1 == negative (maps to -1 for DLC lib)
-                        int32_t quotient = 0;
-                        
-                        if (OK != streamReader.read(fixedLengthFieldMax8, 1))
-                        {
-                            return kIABParserIABDLCError;
-                        }
-
-                        while (1 == fixedLengthFieldMax8)
-                        {
-                            quotient++;
-                            if (OK != streamReader.read(fixedLengthFieldMax8, 1))
-                            {
-                                return kIABParserIABDLCError;
-                            }
-                        }
-                        
-						if (riceRemBits == 0)
-						{
-							remainder = 0;
-						}
-						else
-                        {
-                            // Read rice remainder
-                            if (OK != streamReader.read(remainder, riceRemBits))
-                            {
-                                return kIABParserIABDLCError;
-                            }
-                        }
-                        
-                        if ((remainder != 0) || (quotient > 0))
-                        {
-                            // Read sign bit, 0 maps to +1, 1 maps to -1
-                            if (OK != streamReader.read(fixedLengthFieldMax8, 1))
-                            {
-                                return kIABParserIABDLCError;
-                            }
-
-                            if (1 == fixedLengthFieldMax8)
-                            {
-                                residualSign = -1;
-                            }
-                        }
-                        
-                        // save residual
-                        pResiduals->setQuotient(quotient);
-                        pResiduals->setSign(residualSign);
-                        pResiduals++->setRemainder(remainder);
+                        return kIABParserIABDLCError;
                     }
                 }
             }
@@ -8566,6 +9562,295 @@ namespace ImmersiveAudioBitstream
 			return kIABParserIABDLCError;
 		}
 	}
+
+	iabError IABAudioDataDLC::DeSerialize(StreamReader& streamReader)
+	{
+		return DeSerializeElement(streamReader);
+	}
+
+	iabError IABAudioDataDLC::DeSerialize(BufferReader& streamReader)
+	{
+		return DeSerializeElement(streamReader);
+	}
+
+	iabError IABAudioDataDLC::DeSerializeLazy(StreamReader& streamReader, bool iBorrowPayload)
+	{
+		return DeSerializeLazyElement(streamReader, iBorrowPayload);
+	}
+
+	iabError IABAudioDataDLC::DeSerializeLazy(BufferReader& streamReader, bool iBorrowPayload)
+	{
+		return DeSerializeLazyElement(streamReader, iBorrowPayload);
+	}
+
+	// IABAudioDataDLC::ResetForReuse() implementation
+	void IABAudioDataDLC::ResetForReuse()
+	{
+		IABElement::ResetForReuse();
+
+		audioDataID_ = 0;
+		DLCSize_ = 0;
+
+		// Drop previous payload, including any 96kHz extension. DLCSampleRate_ is set by DeSerialize()
+		DropLazyPayload();
+		audioData_.setShiftBits(0);
+		audioData_.setNumPredRegions48(0);
+		audioData_.setNumPredRegions96(0);
+		audioData_.setNumDLCSubBlocks(0);
+		SetupDLCSubblock();
+	}
+
+    // Number of leading zero bits in a non-zero 64-bit word
+    static inline uint32_t CountLeadingZeros64(uint64_t iWord)
+    {
+#if defined(__GNUC__) || defined(__clang__)
+        return static_cast<uint32_t>(__builtin_clzll(iWord));
+#elif defined(_MSC_VER) && defined(_M_X64)
+        unsigned long index = 0;
+        _BitScanReverse64(&index, iWord);
+        return static_cast<uint32_t>(63 - index);
+#else
+        uint32_t count = 0;
+        while ((iWord & 0x8000000000000000ULL) == 0)
+        {
+            iWord <<= 1;
+            count++;
+        }
+        return count;
+#endif
+    }
+
+    // Signed value of a Rice coded residual, sign * ((quotient << RiceRemBits) + remainder), wrapping
+    // around on overflow as the DLC decoder always has. Signs are random, negate without branching.
+    static inline int32_t RiceResidualValue(uint32_t iQuotient, uint32_t iRemainder, uint32_t iRiceRemBits, bool iIsNegative)
+    {
+        uint32_t magnitude = (iQuotient << iRiceRemBits) + iRemainder;
+        uint32_t signMask = 0u - static_cast<uint32_t>(iIsNegative);
+
+        return static_cast<int32_t>((magnitude ^ signMask) - signMask);
+    }
+
+    // A PCM coded residual is a bit depth wide magnitude followed, unless it is zero, by a sign bit.
+    // Residuals are unpacked from the reader's word lookahead as long as they fit in it, and the
+    // consumed bits are skipped in one go. A residual that does not fit (the end of the stream) is
+    // read field by field.
+    template<typename ReaderType>
+    iabError IABAudioDataDLC::DeSerializePCMResiduals(ReaderType& streamReader, dlc::PCMResidualsSubBlock* iPCMResidualsSubBlock)
+    {
+        uint32_t bitDepth = static_cast<uint32_t>(iPCMResidualsSubBlock->getBitDepth());
+        uint32_t subBlockSize = iPCMResidualsSubBlock->getSize();					// Get residual block size
+        int32_t* pResiduals = iPCMResidualsSubBlock->getResiduals();				// Get pointer to beginning of residual samples
+        uint32_t i = 0;
+
+        if (bitDepth == 0)
+        {
+            for (i = 0; i < subBlockSize; i++)
+            {
+                *pResiduals++ = 0;
+            }
+
+            return kIABNoError;
+        }
+
+        while (i < subBlockSize)
+        {
+            uint64_t window = 0;
+            uint32_t windowBits = 0;
+            uint32_t usedBits = 0;
+
+            if (OK != streamReader.lookahead(window, windowBits, 57))
+            {
+                return kIABParserIABDLCError;
+            }
+
+            // Each residual takes at most bitDepth + 1 bits, bitDepth < 32
+            while (i < subBlockSize && usedBits + bitDepth + 1 <= windowBits)
+            {
+                uint64_t bits = window << usedBits;
+                int32_t residualValue = static_cast<int32_t>(bits >> (64 - bitDepth));
+
+                usedBits += bitDepth;
+
+                if (residualValue != 0)
+                {
+                    // Sign bit, 1 == negative
+                    if ((bits << bitDepth) >> 63)
+                    {
+                        residualValue *= -1;
+                    }
+
+                    usedBits++;
+                }
+
+                *pResiduals++ = residualValue;
+                i++;
+            }
+
+            if (usedBits > 0)
+            {
+                if (OK != streamReader.skip(static_cast<uint8_t>(usedBits)))
+                {
+                    return kIABParserIABDLCError;
+                }
+
+                continue;
+            }
+
+            // Next residual does not fit in the lookahead, read it field by field
+            int32_t residualValue = 0;													// Residual value, as-is retrieved
+            uint8_t residualSign = 0;													// 1-bit sign, 0 == postive, 1 == negative
+
+            if (OK != streamReader.read(residualValue, static_cast<uint8_t>(bitDepth)))
+            {
+                return kIABParserIABDLCError;
+            }
+
+            if (residualValue != 0)
+            {
+                // Read sign bit
+                if (OK != streamReader.read(residualSign, 1))
+                {
+                    return kIABParserIABDLCError;
+                }
+
+                if (1 == residualSign)
+                {
+                    // invert value
+                    residualValue *= -1;
+                }
+            }
+
+            *pResiduals++ = residualValue;
+            i++;
+        }
+
+        return kIABNoError;
+    }
+
+    // A Rice coded residual is a unary quotient (a run of 1s closed by a 0), a RiceRemBits wide
+    // remainder and, unless both are zero, a sign bit. Residuals are decoded from the reader's word
+    // lookahead as long as they fit in it: the quotient is the count of leading 1s, and remainder and
+    // sign are extracted from the same word. The consumed bits are then skipped in one go.
+    // A residual that does not fit (a quotient running past the word, or the end of the stream) is
+    // read field by field.
+    template<typename ReaderType>
+    iabError IABAudioDataDLC::DeSerializeRiceResiduals(ReaderType& streamReader, dlc::RiceResidualsSubBlock* iRiceResidualsSubBlock)
+    {
+        uint32_t riceRemBits = static_cast<uint32_t>(iRiceResidualsSubBlock->getRiceRemBits());
+        uint32_t subBlockSize = iRiceResidualsSubBlock->getSize();					// Get residual block size
+        int32_t* pResiduals = iRiceResidualsSubBlock->getResiduals();				// Get pointer to beginning of residual samples
+        uint32_t i = 0;
+
+        while (i < subBlockSize)
+        {
+            uint64_t window = 0;
+            uint32_t windowBits = 0;
+            uint32_t usedBits = 0;
+
+            if (OK != streamReader.lookahead(window, windowBits, 57))
+            {
+                return kIABParserIABDLCError;
+            }
+
+            while (i < subBlockSize)
+            {
+                uint32_t availableBits = windowBits - usedBits;
+                uint64_t bits = (usedBits < 64) ? (window << usedBits) : 0;
+
+                // ~bits is never zero when fewer than 64 bits are available
+                uint32_t quotient = (~bits == 0) ? 64 : CountLeadingZeros64(~bits);
+                uint32_t codeBits = quotient + 1 + riceRemBits;
+
+                if (codeBits > availableBits)
+                {
+                    break;
+                }
+
+                uint32_t remainder = 0;
+                bool isNegative = false;
+
+                if (riceRemBits != 0)
+                {
+                    remainder = static_cast<uint32_t>((bits << (quotient + 1)) >> (64 - riceRemBits));
+                }
+
+                if ((remainder != 0) || (quotient > 0))
+                {
+                    if (codeBits + 1 > availableBits)
+                    {
+                        break;
+                    }
+
+                    // Sign bit, 0 == positive, 1 == negative
+                    isNegative = (((bits << codeBits) >> 63) != 0);
+
+                    codeBits++;
+                }
+
+                // save residual value
+                *pResiduals++ = RiceResidualValue(quotient, remainder, riceRemBits, isNegative);
+
+                usedBits += codeBits;
+                i++;
+            }
+
+            if (usedBits > 0)
+            {
+                if (OK != streamReader.skip(static_cast<uint8_t>(usedBits)))
+                {
+                    return kIABParserIABDLCError;
+                }
+
+                continue;
+            }
+
+            // Next residual does not fit in the lookahead, read it field by field
+            uint32_t remainder = 0;                         // Residual value, as-is retrieved
+            bool isNegative = false;						// 1-bit sign, 0 == postive, 1 == negative
+            uint32_t quotient = 0;
+            uint8_t fixedLengthFieldMax8 = 0;
+
+            if (OK != streamReader.read(fixedLengthFieldMax8, 1))
+            {
+                return kIABParserIABDLCError;
+            }
+
+            while (1 == fixedLengthFieldMax8)
+            {
+                quotient++;
+                if (OK != streamReader.read(fixedLengthFieldMax8, 1))
+                {
+                    return kIABParserIABDLCError;
+                }
+            }
+
+            if (riceRemBits != 0)
+            {
+                // Read rice remainder
+                if (OK != streamReader.read(remainder, static_cast<uint8_t>(riceRemBits)))
+                {
+                    return kIABParserIABDLCError;
+                }
+            }
+
+            if ((remainder != 0) || (quotient > 0))
+            {
+                // Read sign bit, 0 maps to +1, 1 maps to -1
+                if (OK != streamReader.read(fixedLengthFieldMax8, 1))
+                {
+                    return kIABParserIABDLCError;
+                }
+
+                isNegative = (1 == fixedLengthFieldMax8);
+            }
+
+            // save residual value
+            *pResiduals++ = RiceResidualValue(quotient, remainder, riceRemBits, isNegative);
+            i++;
+        }
+
+        return kIABNoError;
+    }
     
     iabError IABAudioDataDLC::SetupDLCSubblock()
     {
@@ -8779,6 +10064,7 @@ namespace ImmersiveAudioBitstream
 
 		// Clear buffer
 		memset(pcmBytes_, 0, totalByteCount_);
+		pcmSamples_ = pcmBytes_;
 	}
 
 	// Destructor
@@ -8840,6 +10126,7 @@ namespace ImmersiveAudioBitstream
 
 		// Clear pcmBytes_ buffer packing PCM samples into it
 		memset(pcmBytes_, 0, totalByteCount_);
+		pcmSamples_ = pcmBytes_;
 
 		// 24-bit packing
 		if (bitDepthCode_ == kIABBitDepth_24Bit)
@@ -8882,7 +10169,7 @@ namespace ImmersiveAudioBitstream
 		}
 
 		// Unpacking little-endian byte sequence back to PCM samples
-		uint8_t *unpackByteSource = pcmBytes_;
+		const uint8_t *unpackByteSource = pcmSamples_;
 		int32_t* unpackedSampleDestination = oSamples;
 
 		// 24-bit unpacking
@@ -8937,53 +10224,28 @@ namespace ImmersiveAudioBitstream
 		return IABElement::IsIncludedForPacking();
 	}
 
-	// IABAudioDataPCM::Serialize() implementation
-	iabError IABAudioDataPCM::Serialize(std::ostream &outStream)
+	// IABAudioDataPCM::SerializePayload() implementation
+	iabError IABAudioDataPCM::SerializePayload(IABSerializeBuffer& ioBuffer)
 	{
-		// Check if "this" element is included in packing. If not, simply return with no further processing
-		if (!IsIncludedForPacking())
-		{
-			return kIABNoError;
-		}
-
-		// Set up payload writer and buffer
-		elementPayloadWriter_.align();										// reset writer byte alignment
-		elementPayloadBuffer_.seekp(0, std::ios::beg);						// reset internal payload buffer
-		elementPayloadBuffer_.clear();
-		elementHeadBuffer_.seekp(0, std::ios::beg);
-		elementHeadBuffer_.clear();
+		// Payload is appended to ioBuffer, see SerializeElement()
+		StreamWriter& payloadWriter = ioBuffer.GetWriter();
 
-		// Writing data fields (These are currently written into internal "elementPayloadBuffer_")
+		// Writing data fields
 		// Calling method for writing Plex encoded field.
-		write(elementPayloadWriter_, Plex<8>(audioDataID_));
+		write(payloadWriter, Plex<8>(audioDataID_));
 
 		// Write PCM sample bytes, total number of bytes to pack = totalByteCount_
 		// These are already arranged in little endian order during packing
-		elementPayloadWriter_.write(pcmBytes_, totalByteCount_);			// totalByteCount_ bytes
-
-		elementPayloadWriter_.align();										// Align to byte
-
-		// Get buffer length as payload, and set element size
-		IABElementSizeType packedPayloadLength = 0;
-		packedPayloadLength = static_cast<IABElementSizeType>(elementPayloadBuffer_.tellp());
-		SetElementSize(packedPayloadLength);
-
-		// Serialize frame head
-		SerializeHead();
-
-		// Output elementHeadBuffer_ first, followed by elementPayloadBuffer_
-		outStream << elementHeadBuffer_.rdbuf();
-		outStream << elementPayloadBuffer_.rdbuf();
+		ioBuffer.WriteBytes(pcmSamples_, totalByteCount_);			// totalByteCount_ bytes
 
-		// Clear stream contents after packing
-		elementHeadBuffer_.str("");
-		elementPayloadBuffer_.str("");
+		payloadWriter.align();										// Align to byte
 
 		return kIABNoError;
 	}
 
 	// IABAudioDataPCM::DeSerialize() implementation
-	iabError IABAudioDataPCM::DeSerialize(StreamReader& streamReader)
+	template<typename ReaderType>
+	iabError IABAudioDataPCM::DeSerializeElement(ReaderType& streamReader, bool iBorrowSamples)
 	{
 		iabError errorCode = kIABNoError;
 
@@ -9019,6 +10281,14 @@ namespace ImmersiveAudioBitstream
 			return kIABParserIABPCMError;
 		}
 
+		// Refer to samples in the parsed buffer, if allowed
+		if (iBorrowSamples && BorrowBytes(streamReader, totalByteCount_, pcmSamples_))
+		{
+			return kIABNoError;
+		}
+
+		pcmSamples_ = pcmBytes_;
+
 		// Clear pcmBytes_ buffer parsing bytes into it
 		memset(pcmBytes_, 0, totalByteCount_);
 
@@ -9037,6 +10307,36 @@ namespace ImmersiveAudioBitstream
 			return kIABParserIABPCMError;
 		}
 	}
+
+	iabError IABAudioDataPCM::DeSerialize(StreamReader& streamReader)
+	{
+		return DeSerializeElement(streamReader, false);
+	}
+
+	iabError IABAudioDataPCM::DeSerialize(BufferReader& streamReader)
+	{
+		return DeSerializeElement(streamReader, false);
+	}
+
+	iabError IABAudioDataPCM::DeSerializeLazy(StreamReader& streamReader, bool iBorrowSamples)
+	{
+		return DeSerializeElement(streamReader, iBorrowSamples);
+	}
+
+	iabError IABAudioDataPCM::DeSerializeLazy(BufferReader& streamReader, bool iBorrowSamples)
+	{
+		return DeSerializeElement(streamReader, iBorrowSamples);
+	}
+
+	// IABAudioDataPCM::ResetForReuse() implementation
+	void IABAudioDataPCM::ResetForReuse()
+	{
+		IABElement::ResetForReuse();
+
+		// pcmBytes_ is kept, DeSerialize() clears it before reading samples
+		audioDataID_ = 0;
+		pcmSamples_ = pcmBytes_;
+	}
     
     // IABAudioDataPCM::Validate() implementation
     bool IABAudioDataPCM::Validate(IABEventHandler &iEvenHandler, ValidationIssue &iValidationIssue) const
@@ -37,6 +37,8 @@ THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #include "IABElementsAPI.h"
 #include "IABErrors.h"
 #include "IABConstants.h"
+#include "IABFrameArena.h"
+#include "IABDLCCodecContext.h"
 
 // Common stream headers
 #include "StreamTypes.h"
@@ -58,6 +60,19 @@ namespace ImmersiveAudioBitstream
 	typedef BitStreamWriterT<std::ostream> StreamWriter;
 	typedef BitStreamReaderT<std::istream> StreamReader;
 
+	// Reader over an in-memory frame buffer, see IABFrameInterface::Create(const char*, uint32_t).
+	// Element DeSerialize() is provided for both reader types.
+	typedef BitStreamReaderT<RawIStream> BufferReader;
+
+	// Point oBytes to the next iNumBytes bytes in the buffer of a byte aligned reader, instead of
+	// reading them, and skip over them. Returns false, leaving the reader as is, for a StreamReader
+	// or if the buffer ends before.
+	bool BorrowBytes(StreamReader& streamReader, uint32_t iNumBytes, const uint8_t*& oBytes);
+	bool BorrowBytes(BufferReader& streamReader, uint32_t iNumBytes, const uint8_t*& oBytes);
+
+	class IABAudioDataDLC;
+	class IABAudioDataPCM;
+
 	/*****************************************************************************
 	*
 	* Defining classes for container/subframe structures, according to
@@ -65,6 +80,86 @@ namespace ImmersiveAudioBitstream
 	*
 	*****************************************************************************/
 
+	/**
+	* @brief Growable, contiguous packing buffer, with a stream writer appending to it.
+	*
+	* A frame and all its elements are packed in a single pass into one IABSerializeBuffer, see
+	* IABElement::SerializeElement(). Fields that depend on what follows them, such as element
+	* sizes, are written as a placeholder first and filled in with WriteBytesAt() once the data
+	* is packed. Should a Plex field come out wider or narrower than its placeholder, the data
+	* after it is moved with ResizeBytes().
+	*
+	*/
+	class IABSerializeBuffer : public std::streambuf
+	{
+	public:
+
+		// Constructor
+		IABSerializeBuffer();
+
+		// Get stream writer, appending to the buffer
+		StreamWriter& GetWriter();
+
+		// Append bytes, copied at once if the writer is byte aligned
+		void WriteBytes(const uint8_t* iData, uint32_t iSize);
+
+		// Get packed data, and its size in bytes
+		const char* GetData() const;
+		uint64_t GetSize() const;
+
+		// Empty buffer, keeping its storage
+		void Clear();
+
+		// Empty buffer and append to caller memory iData, of iCapacity bytes, instead of own storage.
+		// If data grows beyond iCapacity, it is moved to own storage, and IsAttached() returns false.
+		void Attach(char* iData, uint64_t iCapacity);
+
+		// Is data appended to memory given to Attach()?
+		bool IsAttached() const;
+
+		// Empty buffer, going back to own storage
+		void Detach();
+
+		// Drop data from iSize on
+		void Truncate(uint64_t iSize);
+
+		// Overwrite iSize bytes of packed data from iPosition on with iData
+		void WriteBytesAt(uint64_t iPosition, const uint8_t* iData, uint32_t iSize);
+
+		// Resize the iSize bytes of packed data from iPosition on to iNewSize bytes, moving the data
+		// after them. Bytes added are left undefined. The writer must be byte aligned.
+		void ResizeBytes(uint64_t iPosition, uint32_t iSize, uint32_t iNewSize);
+
+	protected:
+
+		// std::streambuf overrides, appending to storage_
+		int_type overflow(int_type iChar);
+		std::streamsize xsputn(const char* iData, std::streamsize iCount);
+		pos_type seekoff(off_type iOffset, std::ios_base::seekdir iDirection, std::ios_base::openmode iMode);
+
+	private:
+
+		// Not copyable
+		IABSerializeBuffer(const IABSerializeBuffer&);
+		IABSerializeBuffer& operator=(const IABSerializeBuffer&);
+
+		// Grow storage to at least iSize bytes
+		void Reserve(uint64_t iSize);
+
+		// Set size of packed data in storage_
+		void SetSize(uint64_t iSize);
+
+		// Initial storage size
+		static const uint64_t kInitialSize = 4096;
+
+		std::vector<char>	storage_;
+		std::ostream		stream_;
+		StreamWriter		writer_;
+
+		// Appending to caller memory, see Attach()
+		bool				attached_;
+	};
+
 	/**
 	* @brief IABContainerSubFrame, Base class.
 	* Per specification, IABFrame must be wrapped inside a Tag-Length-Value structure called IABIASubFrame
@@ -101,11 +196,12 @@ namespace ImmersiveAudioBitstream
 
 		// Processing method Serilize() to a buffer: packing subframe
 		// Must be implemented by child class
-		virtual iabError Serialize(std::ostream &outStream) = 0;
+		virtual iabError Serialize(StreamWriter& streamWriter) = 0;
 
 		// Parser base class deserialize function.
 		// Must be implemented by child class
 		virtual iabError DeSerialize(StreamReader& streamReader) = 0;
+		virtual iabError DeSerialize(BufferReader& streamReader) = 0;
 
 	protected:
 
@@ -123,10 +219,11 @@ namespace ImmersiveAudioBitstream
 		uint8_t* subframePayload_;									// pointer to "subframeLength_" number of bytes. 
 																	// (Not currently used. TBD: May be used in future for holding Preamble payload.)
 
-		// ************
-		// For packing, stream writer and working buffer for container subframe tag & length
-		StreamWriter		containerHeadWriter_;
-		std::stringstream	containerHeadBuffer_;
+	private:
+
+		// Not copyable
+		IABContainerSubFrame(const IABContainerSubFrame&);
+		IABContainerSubFrame& operator=(const IABContainerSubFrame&);
 	};
 
 	/**
@@ -149,10 +246,12 @@ namespace ImmersiveAudioBitstream
 		~IABIASubFrame() {}
 
 		// Processing method Serilize() to a buffer: packing tag and length
-		iabError Serialize(std::ostream &outStream);
+		iabError Serialize(StreamWriter& streamWriter);
 
 		// Processing method deserilize() from a buffer: parsing tag, length and payload
 		iabError DeSerialize(StreamReader& streamReader);
+		iabError DeSerialize(BufferReader& streamReader);
+		template<typename ReaderType> iabError DeSerializeElement(ReaderType& streamReader);
 	};
 
 	/**
@@ -171,17 +270,34 @@ namespace ImmersiveAudioBitstream
 		// Destructor
 		~IABPreamble() {}
 
-		// Get preamble payload
-		void GetPreamblePayload(uint8_t* &oPreamblePayload, IABSubframeLengthType &oLength) const;
+		// Get preamble payload. A payload borrowed by DeSerialize() is copied on first call.
+		// oPreamblePayload is nullptr if the payload was skipped, see SetPayloadParsing().
+		void GetPreamblePayload(uint8_t* &oPreamblePayload, IABSubframeLengthType &oLength);
 
 		// Set preamble payload (!Note: transfer ownership of underlying payload buffer)
 		iabError SetPreamblePayload(uint8_t* iPreamblePayload, IABSubframeLengthType iLength);
 
+		// Payload handling by DeSerialize(). With iSkipPayload, the payload is skipped over and not kept.
+		// Otherwise with iBorrowPayload, the payload is pointed to in the buffer of a BufferReader instead
+		// of copied, and the buffer must stay valid for as long as the preamble is in use.
+		void SetPayloadParsing(bool iSkipPayload, bool iBorrowPayload);
+
 		// Processing method Serilize() to a buffer: packing tag, length and optionally value (depending on presence)
-		iabError Serialize(std::ostream &outStream);
+		iabError Serialize(StreamWriter& streamWriter);
 
 		// Processing method deserilize() from a buffer: parsing tag, length and value/payload
 		iabError DeSerialize(StreamReader& streamReader);
+		iabError DeSerialize(BufferReader& streamReader);
+		template<typename ReaderType> iabError DeSerializeElement(ReaderType& streamReader);
+
+	private:
+
+		// Payload in the parsed buffer, instead of subframePayload_, see SetPayloadParsing()
+		const uint8_t* borrowedPayload_;
+
+		// See SetPayloadParsing()
+		bool skipPayload_;
+		bool borrowPayload_;
 	};
 
     /*****************************************************************************
@@ -195,7 +311,7 @@ namespace ImmersiveAudioBitstream
      * @brief IAB Element, Base class.
      *
      */
-    class IABElement
+    class IABElement : public IABFrameArenaObject
     {
     public:
 
@@ -220,45 +336,48 @@ namespace ImmersiveAudioBitstream
 		// Interrogate if the element is included for packing
 		bool IsIncludedForPacking();
 
-		// Processing method Serilize() to a buffer: packing an element
+		// Processing method Serilize() to a buffer: packing an element, see SerializeElement()
+		virtual iabError Serialize(std::ostream &outStream);
+
+		// Pack element, head followed by payload, appending to ioBuffer. The payload is written in place by
+		// SerializePayload(), then the head, once element size is known, is moved in front of it.
+		// A frame and all its sub-elements are thus packed in a single pass into one buffer.
+		iabError SerializeElement(IABSerializeBuffer& ioBuffer);
+
+		// Pack element payload, appending to ioBuffer
 		// Must be properly implemented by child class
-		virtual iabError Serialize(std::ostream &outStream) { return kIABNotImplementedError; }
+		virtual iabError SerializePayload(IABSerializeBuffer& /* ioBuffer */) { return kIABNotImplementedError; }
 
 		// Processing method DeSerilize() from a buffer: parsing an element
 		// Must be properly implemented by child class
-        virtual iabError DeSerialize(StreamReader& streamReader) { return kIABNotImplementedError; }
+        virtual iabError DeSerialize(StreamReader& /* streamReader */) { return kIABNotImplementedError; }
+        virtual iabError DeSerialize(BufferReader& /* streamReader */) { return kIABNotImplementedError; }
+
+		// Reset element to its state on construction, so that it can be parsed again.
+		// Overridden by the frame sub-element types that IABFrame::Recycle() keeps for re-use.
+		virtual void ResetForReuse();
         
         // Validate element against specified IAB constraint sets.
-        virtual bool Validate(IABEventHandler &iEvenHandler, ValidationIssue &iValidationIssue) const { return false; }
+        virtual bool Validate(IABEventHandler & /* iEvenHandler */, ValidationIssue & /* iValidationIssue */) const { return false; }
 
 	protected:
 
         // Protected functions
 
-		/**
-		* Serialize element ID and size only, into elementHeadBuffer_. The buffer can be accessed
-		* and retrieved by all derived classes of all element types.
-		* This is typically called after writing element payload, and as a result, the element size
-		* becomes known. Caller need to set element size before serializing updated element
-		* head into elementHeadBuffer_.
-		*
-		*/
-		iabError SerializeHead();
-
 		/**
 		* Deserialize element ID and size only... (To be expanded)
 		*
 		*/
-		iabError DeSerializeHead(StreamReader& streamReader);
+		template<typename ReaderType> iabError DeSerializeHead(ReaderType& streamReader);
 
         // Set element size
         iabError SetElementSize(IABElementSizeType iElementSize);
         
         // Skip deSerializing current element, advance stream reader by the element's size to new stream position
-        iabError SkipDeSerializeCurrentElement(StreamReader& streamReader);
+        template<typename ReaderType> iabError SkipDeSerializeCurrentElement(ReaderType& streamReader);
 
 		// Peek next sub-element ID
-		iabError PeekNextElementID(StreamReader& streamReader, uint32_t &oElementID);
+		template<typename ReaderType> iabError PeekNextElementID(ReaderType& streamReader, uint32_t &oElementID);
 
 		// Protected variables
 
@@ -272,18 +391,15 @@ namespace ImmersiveAudioBitstream
 		// Packing enable flag - is this element included (enabled) in IAB packing?
 		int32_t packingEnable_;					// default: 1, packing enabled
 
-		// ************
-		// For packing, stream writer and working buffer for elementID_ and elementSize_
-		StreamWriter		elementHeadWriter_;
-		std::stringstream	elementHeadBuffer_;
-
-		// stream writer and working buffer for element payload
-		StreamWriter		elementPayloadWriter_;
-		std::stringstream	elementPayloadBuffer_;
-
 		// ************
 		// For parsing, stream reader
 		StreamReader*		elementReader_;				// stream reader for parsing
+
+	private:
+
+		// Not copyable
+		IABElement(const IABElement&);
+		IABElement& operator=(const IABElement&);
 	};
 
     /**
@@ -300,6 +416,7 @@ namespace ImmersiveAudioBitstream
         // Constructors
         IABFrame();											// Default contructor for client-constructed IAB frame (content creation)
         IABFrame(std::istream* inputStream);				// Contructor with input stream, for IAB frame constructed from parsing an inpuit IAB bitstream/frame
+        IABFrame(const char* iFrameBuffer, uint32_t iBufferSize);	// Contructor with frame data buffer, for IAB frame parsed in place from memory
 
         // Destructor
         ~IABFrame();
@@ -365,13 +482,56 @@ namespace ImmersiveAudioBitstream
 		bool AreSubElementsEnabledForPacking();
 
 		// Serialize IAB frame element to output stream.
-        // This is the only Serialize() that is exposed to users
+        // This is one of the two Serialize() that are exposed to users
 		iabError Serialize(std::ostream &outStream);
 
+		// Serialize IAB frame element into caller memory, see IABFrameInterface::Serialize()
+		iabError Serialize(uint8_t* oBuffer, uint32_t iBufferSize, uint32_t &oFrameSize);
+
+		// Serialize IAB frame element payload to buffer, see IABElement::SerializeElement().
+		iabError SerializePayload(IABSerializeBuffer& ioBuffer);
+
         // Processing method DeSerilize() from a buffer: parsing a frame
         // This is the only DeSerialize() that is exposed to users
         iabError DeSerialize();
 
+		// Number of bytes of the frame data buffer consumed by DeSerialize(), for frames created on a buffer
+		uint64_t GetBufferBytesParsed() const;
+
+		// Prepare a parsed frame for parsing the next frame, from the same input stream or from a new
+		// frame data buffer. The frame is reset to its state on construction, except that its sub-elements
+		// are kept and re-used by the next DeSerialize(), instead of being deleted and allocated again.
+		iabError Recycle();
+		iabError Recycle(const char* iFrameBuffer, uint32_t iBufferSize);
+
+		// Allocate sub-elements parsed by DeSerialize() from an arena owned by the frame, see IABFrameArena.
+		// To be called before DeSerialize(). Parsed sub-elements must not be used after the frame is
+		// deleted or recycled, including ones taken out of the frame with ClearSubElements().
+		void EnableArena();
+
+		// Parse audio data sub-elements lazily, see IABAudioDataDLC::DeSerializeLazy(). To be called
+		// before DeSerialize(). With iBorrowAudioData, for frames created on a data buffer, their coded
+		// audio is not copied, and the buffer must stay valid for as long as the frame is in use.
+		void SetLazyAudioData(bool iEnable, bool iBorrowAudioData);
+
+		// Parse the frame data fields only, skipping sub-elements to the end of the IA subframe. To be
+		// called before DeSerialize().
+		void SetHeaderOnly(bool iEnable);
+
+		// Preamble payload handling, see IABPreamble::SetPayloadParsing(). To be called before DeSerialize().
+		void SetPreamblePayloadParsing(bool iSkipPayload, bool iBorrowPayload);
+
+		// Get AudioDataIDs of the AudioDataDLC and AudioDataPCM sub-elements, in frame order
+		void GetAudioDataIDs(std::vector<IABAudioDataIDType> &oAudioDataIDs);
+
+		// Decode iSampleCount samples of the AudioDataDLC or AudioDataPCM sub-element with iAudioDataID.
+		// AudioDataDLC is decoded at its DLC sample rate. The first sub-element is used if the ID is not unique.
+		iabError DecodeAudioData(IABAudioDataIDType iAudioDataID, int32_t* oSamples, uint32_t iSampleCount);
+
+		// Decode iSampleCount samples of every AudioDataDLC and AudioDataPCM sub-element, oSamples[i]
+		// receiving the i-th one in frame order. iNumBuffers must match the number of those sub-elements.
+		iabError DecodeAllAudioData(int32_t* const* oSamples, uint32_t iNumBuffers, uint32_t iSampleCount);
+
 		// Get number of known but unallowed frame sub-elements parsed
 		uint32_t GetNumUnallowedSubElements() const;
 
@@ -385,10 +545,20 @@ namespace ImmersiveAudioBitstream
 
 		// Processing method DeSerilize() from a reader
 		// This overloading call is NOT used for frame. It is will be implemented as ... (TBD)
-		iabError DeSerialize(StreamReader& streamReader) { return kIABNotImplementedError; }
+		iabError DeSerialize(StreamReader& /* streamReader */) { return kIABNotImplementedError; }
+		iabError DeSerialize(BufferReader& /* streamReader */) { return kIABNotImplementedError; }
 
 		void DeleteSubElements();
 
+		// Reset frame for Recycle(), keeping its sub-elements
+		void ResetForRecycling();
+
+		// Delete sub-elements kept by Recycle()
+		void DeleteRecycledSubElements();
+
+		// Take a sub-element of type iElementID kept by Recycle(), nullptr if none
+		IABElement* TakeRecycledSubElement(IABElementIDType iElementID);
+
         // IA bitstream version
         uint8_t	version_;
 
@@ -410,11 +580,80 @@ namespace ImmersiveAudioBitstream
         // A vector of sub/child IABElements contained in the frame
         std::vector<IABElement*> frameSubElements_;
         
+        // For frames created on a data buffer, reader used in place of elementReader_
+        BufferReader* bufferReader_;
+
+        // Sub-elements of the previously parsed frame kept by Recycle(), by element type, and the
+        // frame parameters they were created for
+        std::map<IABElementIDType, std::vector<IABElement*> > recycledSubElements_;
+        IABFrameRateType recycledFrameRate_;
+        IABSampleRateType recycledSampleRate_;
+        IABBitDepthType recycledBitDepth_;
+
+        // Arena for parsed sub-elements, nullptr if they are allocated from the heap. See EnableArena().
+        IABFrameArena* arena_;
+
+        // Lazy parsing of audio data sub-elements, and borrowing of their coded audio, see SetLazyAudioData()
+        bool lazyAudioData_;
+        bool borrowAudioData_;
+
+        // Frame data fields only are parsed, see SetHeaderOnly()
+        bool headerOnly_;
+
+        // Set when the last parse skipped the sub-elements, the frame cannot be serialized then
+        bool subElementsSkipped_;
+
+        // Packing buffer for Serialize(), kept from one frame to the next, created on first use
+        IABSerializeBuffer* frameSerializeBuffer_;
+
+        // Codec context for DecodeAllAudioData() when no IABDLCCodecContext is current, created on first use
+        IABDLCCodecContext* dlcCodecContext_;
+
+        // Audio data sub-element of the frame, with its AudioDataID. One of dlcElement_ and pcmElement_ is set.
+        struct AudioDataEntry
+        {
+            IABAudioDataIDType audioDataID_;
+            IABAudioDataDLC* dlcElement_;
+            IABAudioDataPCM* pcmElement_;
+        };
+
+        // Audio data sub-elements in frame order, and the same sorted by AudioDataID. Built while parsing,
+        // and rebuilt on first use after the sub-element list or an AudioDataID is changed, see CheckAudioDataIndex().
+        std::vector<AudioDataEntry> audioDataElements_;
+        std::vector<AudioDataEntry> audioDataIndex_;
+        bool audioDataIndexValid_;
+
+        // Add a parsed audio data sub-element to audioDataElements_
+        void AddAudioDataEntry(IABElement* iSubElement, IABElementIDType iElementID);
+
+        // Sort audioDataElements_ into audioDataIndex_, rebuilding audioDataElements_ first if the
+        // sub-element list was changed after parsing
+        void UpdateAudioDataIndex();
+
+        // Update audioDataElements_ and audioDataIndex_ before use, if the sub-element list or the
+        // AudioDataID of a sub-element was changed since they were built
+        void CheckAudioDataIndex();
+
+        // Order of audioDataIndex_
+        static bool IsAudioDataIDLess(const AudioDataEntry& iLeft, const AudioDataEntry& iRight);
+
+        // Decode audio data of iEntry into oSamples
+        static iabError DecodeAudioDataEntry(const AudioDataEntry& iEntry, int32_t* oSamples, uint32_t iSampleCount);
+
+        // Pack preamble and IA subframe into frameSerializeBuffer_, see Serialize()
+        iabError SerializeFrame();
+        
+        // Parse preamble, IA subframe and frame element, see DeSerialize()
+        template<typename ReaderType> iabError ParseFrame(ReaderType& streamReader);
+        
         // Parse fields in frame header: sample rate, bitdepth, frame rate etc...
-        iabError ParseFrameDataFields();
+        template<typename ReaderType> iabError ParseFrameDataFields(ReaderType& streamReader);
+        
+        // Skip frame sub-elements to iSubframeEnd, the end of the IA subframe, see SetHeaderOnly()
+        template<typename ReaderType> iabError SkipFrameBody(ReaderType& streamReader, std::ios_base::streampos iSubframeEnd);
         
 		// Parse IABFrame sub-elements
-		iabError ParseFrameSubElement();
+		template<typename ReaderType> iabError ParseFrameSubElement(ReaderType& streamReader);
         
         // *****************************************
         // Class internal variable
@@ -457,7 +696,7 @@ namespace ImmersiveAudioBitstream
      * and metadata elements pertaining to the bed channel.
      *
      */
-    class IABChannel : public IABChannelInterface
+    class IABChannel : public IABChannelInterface, public IABFrameArenaObject
     {
     public:
 
@@ -502,6 +741,8 @@ namespace ImmersiveAudioBitstream
 
 		// DeSerialize an IAB Channel from buffer.
 		iabError DeSerialize(StreamReader& streamReader);
+		iabError DeSerialize(BufferReader& streamReader);
+		template<typename ReaderType> iabError DeSerializeElement(ReaderType& streamReader);
 
         // Validate contents against SMPTE IAB Specification
         bool Validate(IABEventHandler &iEvenHandler, ValidationIssue &iValidationIssue) const;
@@ -607,11 +848,16 @@ namespace ImmersiveAudioBitstream
 		// Interrogate if the bed definition element is included for packing
 		bool IsIncludedForPacking();
 
-		// Serialize IAB bed definition element to buffer.
-		iabError Serialize(std::ostream &outStream);
+		// Serialize IAB bed definition element payload to buffer, see IABElement::SerializeElement().
+		iabError SerializePayload(IABSerializeBuffer& ioBuffer);
 
 		// DeSerialize IAB bed definition element from buffer.
 		iabError DeSerialize(StreamReader& streamReader);
+		iabError DeSerialize(BufferReader& streamReader);
+		template<typename ReaderType> iabError DeSerializeElement(ReaderType& streamReader);
+
+		// Reset to state on construction, for re-use by IABFrame::Recycle()
+		void ResetForReuse();
 
 		// Get number of known but unallowed bed sub-elements parsed
 		uint32_t GetNumUnallowedSubElements() const;
@@ -687,10 +933,10 @@ namespace ImmersiveAudioBitstream
 		void UpdatePackingEnabledSubElementCount();
 
         // Parse a bed channel from bitstream
-        iabError ParseBedChannel(StreamReader& streamReader);
+        template<typename ReaderType> iabError ParseBedChannel(ReaderType& streamReader);
 
         // Parse bed sub-element from bitstream
-        iabError ParseBedSubElement(StreamReader& streamReader);
+        template<typename ReaderType> iabError ParseBedSubElement(ReaderType& streamReader);
     };
 
     /**
@@ -703,7 +949,7 @@ namespace ImmersiveAudioBitstream
      * the distribution configuration to a different playback configuration, for the sub block duration.
      *
      */
-    class IABBedRemapSubBlock : public IABBedRemapSubBlockInterface
+    class IABBedRemapSubBlock : public IABBedRemapSubBlockInterface, public IABFrameArenaObject
     {
     public:
 
@@ -744,9 +990,11 @@ namespace ImmersiveAudioBitstream
 
 		// Deserialize IAB bed remap sub block from buffer. This is called to deserialize all remap sub-blocks except the first.
 		iabError DeSerialize(StreamReader& streamReader);
+		iabError DeSerialize(BufferReader& streamReader);
+		template<typename ReaderType> iabError DeSerializeElement(ReaderType& streamReader);
 
 		// This is called directly to deserialize first remap sub-block of a bed remap element.
-		iabError DeSerializeSubBlock(StreamReader& streamReader);
+		template<typename ReaderType> iabError DeSerializeSubBlock(ReaderType& streamReader);
         
         // Validate contents against SMPTE IAB Specification
         bool Validate(IABEventHandler &iEvenHandler, ValidationIssue &iValidationIssue) const;
@@ -829,11 +1077,13 @@ namespace ImmersiveAudioBitstream
 		// Interrogate if the bed remap element is included for packing
 		bool IsIncludedForPacking();
 
-		// Serialize IAB bed remap element to buffer.
-		iabError Serialize(std::ostream &outStream);
+		// Serialize IAB bed remap element payload to buffer, see IABElement::SerializeElement().
+		iabError SerializePayload(IABSerializeBuffer& ioBuffer);
 
 		// DeSerialize IAB bed remap element from buffer.
 		iabError DeSerialize(StreamReader& streamReader);
+		iabError DeSerialize(BufferReader& streamReader);
+		template<typename ReaderType> iabError DeSerializeElement(ReaderType& streamReader);
         
         // Validate contents against SMPTE IAB Specification
         bool Validate(IABEventHandler &iEvenHandler, ValidationIssue &iValidationIssue) const;
@@ -870,7 +1120,7 @@ namespace ImmersiveAudioBitstream
      * for the pan sub block duration.
      *
      */
-    class IABObjectSubBlock : public IABObjectSubBlockInterface
+    class IABObjectSubBlock : public IABObjectSubBlockInterface, public IABFrameArenaObject
     {
     public:
 
@@ -930,9 +1180,11 @@ namespace ImmersiveAudioBitstream
 
 		// DeSerialize IAB object sub block from buffer. This is called to deserialize all pan sub-blocks except the first block in a frame.
 		iabError DeSerialize(StreamReader& streamReader);
+		iabError DeSerialize(BufferReader& streamReader);
+		template<typename ReaderType> iabError DeSerializeElement(ReaderType& streamReader);
 
 		// This is called directly to deserialize first pan sub-block of a frame, for object definition.
-		iabError DeSerializeSubBlock(StreamReader& streamReader);
+		template<typename ReaderType> iabError DeSerializeSubBlock(ReaderType& streamReader);
 
         // Validate contents against SMPTE IAB Specification
         bool Validate(IABEventHandler &iEvenHandler, ValidationIssue &iValidationIssue) const;
@@ -1054,11 +1306,16 @@ namespace ImmersiveAudioBitstream
 		// Interrogate if the object definition element is included for packing
 		bool IsIncludedForPacking();
 
-		// Serialize IAB object definition element to buffer.
-		iabError Serialize(std::ostream &outStream);
+		// Serialize IAB object definition element payload to buffer, see IABElement::SerializeElement().
+		iabError SerializePayload(IABSerializeBuffer& ioBuffer);
 
 		// DeSerialize IAB object definition element from buffer.
 		iabError DeSerialize(StreamReader& streamReader);
+		iabError DeSerialize(BufferReader& streamReader);
+		template<typename ReaderType> iabError DeSerializeElement(ReaderType& streamReader);
+
+		// Reset to state on construction, for re-use by IABFrame::Recycle()
+		void ResetForReuse();
 
 		// Get number of known but unallowed object sub-elements parsed
 		uint32_t GetNumUnallowedSubElements() const;
@@ -1138,7 +1395,7 @@ namespace ImmersiveAudioBitstream
 		void UpdatePackingEnabledSubElementCount();
 
         // Parse object sub-element from bitstream
-        iabError ParseObjectSubElement(StreamReader& streamReader);
+        template<typename ReaderType> iabError ParseObjectSubElement(ReaderType& streamReader);
     };
 
 	/**
@@ -1149,7 +1406,7 @@ namespace ImmersiveAudioBitstream
 	* It contains alternative (enhanced) zone definition and gains for object rendering, for the sub block.
 	*
 	*/
-	class IABZone19SubBlock : public IABZone19SubBlockInterface
+	class IABZone19SubBlock : public IABZone19SubBlockInterface, public IABFrameArenaObject
 	{
 	public:
 
@@ -1173,9 +1430,11 @@ namespace ImmersiveAudioBitstream
 
 		// DeSerialize IAB zone19 sub block from buffer. This is called to deserialize all zone19 sub-blocks except the first block in a frame.
 		iabError DeSerialize(StreamReader& streamReader);
+		iabError DeSerialize(BufferReader& streamReader);
+		template<typename ReaderType> iabError DeSerializeElement(ReaderType& streamReader);
 
 		// This is called directly to deserialize first zone19 sub-block of a frame, for IABObjectZoneDefinition19.
-		iabError DeSerializeSubBlock(StreamReader& streamReader);
+		template<typename ReaderType> iabError DeSerializeSubBlock(ReaderType& streamReader);
         
         // Validate contents against SMPTE IAB Specification
         bool Validate(IABEventHandler &iEvenHandler, ValidationIssue &iValidationIssue) const;
@@ -1223,11 +1482,13 @@ namespace ImmersiveAudioBitstream
 		// Interrogate if the zone19 element is included for packing
 		bool IsIncludedForPacking();
 
-		// Serialize IAB object definition element to buffer.
-		iabError Serialize(std::ostream &outStream);
+		// Serialize IAB object definition element payload to buffer, see IABElement::SerializeElement().
+		iabError SerializePayload(IABSerializeBuffer& ioBuffer);
 
 		// DeSerialize IAB object zone 19 definition element from buffer.
 		iabError DeSerialize(StreamReader& streamReader);
+		iabError DeSerialize(BufferReader& streamReader);
+		template<typename ReaderType> iabError DeSerializeElement(ReaderType& streamReader);
         
         // Validate contents against SMPTE IAB Specification
         bool Validate(IABEventHandler &iEvenHandler, ValidationIssue &iValidationIssue) const;
@@ -1277,11 +1538,16 @@ namespace ImmersiveAudioBitstream
 		// Interrogate if the authoringtoolinfo element is included for packing
 		bool IsIncludedForPacking();
 
-		// Serialize IAB PCM data audio element to buffer.
-		iabError Serialize(std::ostream &outStream);
+		// Serialize IAB PCM data audio element payload to buffer, see IABElement::SerializeElement().
+		iabError SerializePayload(IABSerializeBuffer& ioBuffer);
 
 		// DeSerialize IAB PCM audio data element to buffer.
 		iabError DeSerialize(StreamReader& streamReader);
+		iabError DeSerialize(BufferReader& streamReader);
+		template<typename ReaderType> iabError DeSerializeElement(ReaderType& streamReader);
+
+		// Reset to state on construction, for re-use by IABFrame::Recycle()
+		void ResetForReuse();
         
         // Validate contents against SMPTE IAB Specification
         bool Validate(IABEventHandler &iEvenHandler, ValidationIssue &iValidationIssue) const;
@@ -1337,11 +1603,16 @@ namespace ImmersiveAudioBitstream
 		// Interrogate if the user data element is included for packing
 		bool IsIncludedForPacking();
 
-		// Serialize IAB PCM data audio element to buffer.
-		iabError Serialize(std::ostream &outStream);
+		// Serialize IAB PCM data audio element payload to buffer, see IABElement::SerializeElement().
+		iabError SerializePayload(IABSerializeBuffer& ioBuffer);
 
 		// DeSerialize IAB PCM audio data element to buffer.
 		iabError DeSerialize(StreamReader& streamReader);
+		iabError DeSerialize(BufferReader& streamReader);
+		template<typename ReaderType> iabError DeSerializeElement(ReaderType& streamReader);
+
+		// Reset to state on construction, for re-use by IABFrame::Recycle()
+		void ResetForReuse();
         
         // Validate contents against SMPTE IAB Specification
         bool Validate(IABEventHandler &iEvenHandler, ValidationIssue &iValidationIssue) const;
@@ -1408,11 +1679,24 @@ namespace ImmersiveAudioBitstream
 		// Interrogate if the DLC element is included for packing
 		bool IsIncludedForPacking();
 
-		// Serialize IAB DLC audio data element to buffer.
-		iabError Serialize(std::ostream &outStream);
+		// Serialize IAB DLC audio data element payload to buffer, see IABElement::SerializeElement().
+		iabError SerializePayload(IABSerializeBuffer& ioBuffer);
 
 		// DeSerialize IAB DLC audio data element to buffer.
 		iabError DeSerialize(StreamReader& streamReader);
+		iabError DeSerialize(BufferReader& streamReader);
+		template<typename ReaderType> iabError DeSerializeElement(ReaderType& streamReader);
+
+		// DeSerialize IAB DLC audio data element, parsing AudioDataID, DLCSize and sample rate only.
+		// The rest of the payload is kept, and parsed on first access, see ParseLazyPayload(). With
+		// iBorrowPayload, a payload in the buffer of a BufferReader is not copied, and the buffer must
+		// outlive the element.
+		iabError DeSerializeLazy(StreamReader& streamReader, bool iBorrowPayload);
+		iabError DeSerializeLazy(BufferReader& streamReader, bool iBorrowPayload);
+		template<typename ReaderType> iabError DeSerializeLazyElement(ReaderType& streamReader, bool iBorrowPayload);
+
+		// Reset to state on construction, for re-use by IABFrame::Recycle()
+		void ResetForReuse();
         
         // Validate contents against SMPTE IAB Specification
         bool Validate(IABEventHandler &iEvenHandler, ValidationIssue &iValidationIssue) const;
@@ -1420,18 +1704,22 @@ namespace ImmersiveAudioBitstream
     private:
 
 		/**
-		* Encoder instance used to encode PCM into dlc:AudioData
-		* (The simple encoder supports PCM wrapping only)
+		* Encoder used to encode 96 kHz PCM into dlc:AudioData. Its filters run across frames, so unlike
+		* the 48 kHz encoder and the decoder borrowed from IABDLCCodecContext, it belongs to the element.
+		* Initialized to nullptr, allocated upon first 96 kHz EncodeMonoPCMToDLC() call.
 		*
 		*/
-		dlc::SimpleEncoder dlcSimpleEncoder_;
-        
-        /**
-         * Decoder instance used to decode dlc:AudioData into PCM
-         * (The decoder supports PCM wrapping only)
-         *
-         */
-        dlc::FullDecoder dlcFullDecoder_;
+		dlc::SimpleEncoder* dlcSimpleEncoder96k_;
+
+		/**
+		* Codec context used when no IABDLCCodecContext is current, as for an element encoded or decoded
+		* on its own. Initialized to nullptr, allocated upon first such use and kept for the next calls.
+		*
+		*/
+		IABDLCCodecContext* dlcCodecContext_;
+
+		// Current codec context, or dlcCodecContext_ if there is none
+		IABDLCCodecContext* GetDLCCodecContext();
 
 		/**
 		* AudioData instance (DLC lib). Owned and managed by IABAudioDataDLC
@@ -1439,10 +1727,11 @@ namespace ImmersiveAudioBitstream
 		*/
 		dlc::AudioData audioData_;
 
-		// Pointer to internal buffer that stores decoded PCM samples
-		// from audioData_
-		// Intialized to nullptr, allocated upon DecodeDLCToMonoPCM() call
-		int32_t* decodedPCM_;
+		// Payload kept unparsed by DeSerializeLazy(), nullptr if there is none. Points either into
+		// the parsed buffer, or to lazyPayloadCopy_.
+		const uint8_t* lazyPayload_;
+		uint32_t lazyPayloadSize_;
+		std::vector<uint8_t> lazyPayloadCopy_;
 
 		// Identifies the instance of a mono audio essence
         IABAudioDataIDType audioDataID_;				// plex(8) (with range set to uint32_t)
@@ -1525,6 +1814,24 @@ namespace ImmersiveAudioBitstream
 
         // Setup DLC subblocks parameters
         iabError SetupDLCSubblock();
+
+        // Parse payload fields AudioDataID, DLCSize and sample rate, and set up DLC subblocks for them
+        template<typename ReaderType> iabError DeSerializeHeaderFields(ReaderType& streamReader);
+
+        // Parse the rest of the payload: shift bits, predictor information and residuals
+        template<typename ReaderType> iabError DeSerializeCodedAudio(ReaderType& streamReader);
+
+        // Parse the payload kept by DeSerializeLazy(), if any, into audioData_
+        iabError ParseLazyPayload();
+
+        // Drop the payload kept by DeSerializeLazy(), if any
+        void DropLazyPayload();
+
+        // Decode the residuals of a PCM coded sub-block, following its bit depth field
+        template<typename ReaderType> iabError DeSerializePCMResiduals(ReaderType& streamReader, dlc::PCMResidualsSubBlock* iPCMResidualsSubBlock);
+
+        // Decode the residuals of a Rice/Golomb coded sub-block, following its RiceRemBits field
+        template<typename ReaderType> iabError DeSerializeRiceResiduals(ReaderType& streamReader, dlc::RiceResidualsSubBlock* iRiceResidualsSubBlock);
    };
 
     /**
@@ -1580,11 +1887,21 @@ namespace ImmersiveAudioBitstream
 		// Interrogate if the PCM element is included for packing
 		bool IsIncludedForPacking();
 
-		// Serialize IAB PCM data audio element to buffer.
-		iabError Serialize(std::ostream &outStream);
+		// Serialize IAB PCM data audio element payload to buffer, see IABElement::SerializeElement().
+		iabError SerializePayload(IABSerializeBuffer& ioBuffer);
 
 		// DeSerialize IAB PCM audio data element to buffer.
 		iabError DeSerialize(StreamReader& streamReader);
+		iabError DeSerialize(BufferReader& streamReader);
+
+		// DeSerialize IAB PCM audio data element. With iBorrowSamples, samples in the buffer of a
+		// BufferReader are not copied, and the buffer must outlive the element.
+		iabError DeSerializeLazy(StreamReader& streamReader, bool iBorrowSamples);
+		iabError DeSerializeLazy(BufferReader& streamReader, bool iBorrowSamples);
+		template<typename ReaderType> iabError DeSerializeElement(ReaderType& streamReader, bool iBorrowSamples);
+
+		// Reset to state on construction, for re-use by IABFrame::Recycle()
+		void ResetForReuse();
 
 		// Validate contents against SMPTE IAB Specification
 		bool Validate(IABEventHandler &iEvenHandler, ValidationIssue &iValidationIssue) const;
@@ -1614,6 +1931,9 @@ namespace ImmersiveAudioBitstream
 
 		// Size in bytes of DLC data (payload)
 		uint8_t* pcmBytes_;								// 16-bit or 24-bit PCM samples in bytes, little endian
+
+		// PCM samples in use: pcmBytes_, or samples in the parsed buffer, see DeSerializeLazy()
+		const uint8_t* pcmSamples_;
 	};
 
 } // namespace ImmersiveAudioBitstream
@@ -0,0 +1,183 @@
+/* Copyright (c) 2020 Xperi Corporation (and its subsidiaries). All rights reserved.
+ 
+Permission is hereby granted, free of charge, to any person obtaining
+a copy of this software and associated documentation files (the "Software"),
+to deal in the Software without restriction, including without limitation
+the rights to use, copy, modify, merge, publish, distribute, sublicense,
+and/or sell copies of the Software, and to permit persons to whom the
+Software is furnished to do so, subject to the following conditions:
+ 
+The above copyright notice and this permission notice shall be included
+in all copies or substantial portions of the Software.
+ 
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ 
+IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT
+OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR
+THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#include <new>
+
+#include "IABFrameArena.h"
+#include "IABConstants.h"
+
+#ifdef USE_MDA_NULLPTR
+/* support lack of nullptr on older C++ compilers such as g++-4.4.7 */
+#include "nullptrOldCompilers.h"
+#endif
+
+namespace SMPTE
+{
+namespace ImmersiveAudioBitstream
+{
+	// Current arena, per thread. Initialized with 0: thread-local storage needs a constant initializer,
+	// which the nullptr of USE_MDA_NULLPTR is not.
+	static IAB_THREAD_LOCAL IABFrameArena* currentFrameArena = 0;
+
+	// ****************************************************************************
+	// IABFrameArena class implementation
+	// ****************************************************************************
+
+	// Constructor implementation
+	IABFrameArena::IABFrameArena()
+	{
+		currentBlock_ = 0;
+		currentOffset_ = 0;
+		bytesAllocated_ = 0;
+	}
+
+	// Destructor implementation
+	IABFrameArena::~IABFrameArena()
+	{
+		for (std::vector<Block>::iterator iter = blocks_.begin(); iter != blocks_.end(); iter++)
+		{
+			::operator delete(iter->data_);
+		}
+
+		blocks_.clear();
+	}
+
+	// IABFrameArena::Allocate() implementation
+	void* IABFrameArena::Allocate(size_t iSize)
+	{
+		size_t alignedSize = (iSize + kAlignment - 1) & ~(kAlignment - 1);
+
+		// Move on to the next block that has room, keeping blocks in fill order for Reset()
+		while ((currentBlock_ < blocks_.size()) && (currentOffset_ + alignedSize > blocks_[currentBlock_].size_))
+		{
+			currentBlock_++;
+			currentOffset_ = 0;
+		}
+
+		if (currentBlock_ == blocks_.size())
+		{
+			Block newBlock;
+			newBlock.size_ = (alignedSize > kBlockSize) ? alignedSize : kBlockSize;
+			newBlock.data_ = static_cast<uint8_t*>(::operator new(newBlock.size_));
+			blocks_.push_back(newBlock);
+			currentOffset_ = 0;
+		}
+
+		void* allocation = blocks_[currentBlock_].data_ + currentOffset_;
+		currentOffset_ += alignedSize;
+		bytesAllocated_ += alignedSize;
+
+		return allocation;
+	}
+
+	// IABFrameArena::Reset() implementation
+	void IABFrameArena::Reset()
+	{
+		currentBlock_ = 0;
+		currentOffset_ = 0;
+		bytesAllocated_ = 0;
+	}
+
+	// IABFrameArena::GetBytesAllocated() implementation
+	size_t IABFrameArena::GetBytesAllocated() const
+	{
+		return bytesAllocated_;
+	}
+
+	// IABFrameArena::GetCurrent() implementation
+	IABFrameArena* IABFrameArena::GetCurrent()
+	{
+		return currentFrameArena;
+	}
+
+	// IABFrameArena::Scope implementation
+	IABFrameArena::Scope::Scope(IABFrameArena* iArena)
+	{
+		previous_ = currentFrameArena;
+		currentFrameArena = iArena;
+	}
+
+	IABFrameArena::Scope::~Scope()
+	{
+		currentFrameArena = previous_;
+	}
+
+	// ****************************************************************************
+	// IABFrameArenaObject class implementation
+	// ****************************************************************************
+
+	// Each allocation is preceded by a header holding the arena it came from, nullptr for the heap.
+	// The header is kAlignment bytes, to keep objects aligned.
+	static const size_t kArenaObjectHeaderSize = IABFrameArena::kAlignment;
+
+	// IABFrameArenaObject::operator new() implementation
+	void* IABFrameArenaObject::operator new(size_t iSize)
+	{
+		IABFrameArena* arena = currentFrameArena;
+		void* allocation = nullptr;
+
+		if (arena)
+		{
+			allocation = arena->Allocate(iSize + kArenaObjectHeaderSize);
+		}
+		else
+		{
+			allocation = ::operator new(iSize + kArenaObjectHeaderSize);
+		}
+
+		*static_cast<IABFrameArena**>(allocation) = arena;
+
+		return static_cast<uint8_t*>(allocation) + kArenaObjectHeaderSize;
+	}
+
+	// IABFrameArenaObject::operator delete() implementation
+	void IABFrameArenaObject::operator delete(void* iObject)
+	{
+		if (nullptr == iObject)
+		{
+			return;
+		}
+
+		void* allocation = static_cast<uint8_t*>(iObject) - kArenaObjectHeaderSize;
+
+		// Arena allocations are released by IABFrameArena::Reset() or the arena destructor
+		if (nullptr == *static_cast<IABFrameArena**>(allocation))
+		{
+			::operator delete(allocation);
+		}
+	}
+
+	// IABFrameArenaObject::IsArenaAllocated() implementation
+	bool IABFrameArenaObject::IsArenaAllocated(const void* iObject)
+	{
+		if (nullptr == iObject)
+		{
+			return false;
+		}
+
+		const void* allocation = static_cast<const uint8_t*>(iObject) - kArenaObjectHeaderSize;
+
+		return (nullptr != *static_cast<IABFrameArena* const*>(allocation));
+	}
+
+} // namespace ImmersiveAudioBitstream
+} // namespace SMPTE
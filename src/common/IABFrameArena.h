@@ -0,0 +1,151 @@
+/* Copyright (c) 2020 Xperi Corporation (and its subsidiaries). All rights reserved.
+ 
+Permission is hereby granted, free of charge, to any person obtaining
+a copy of this software and associated documentation files (the "Software"),
+to deal in the Software without restriction, including without limitation
+the rights to use, copy, modify, merge, publish, distribute, sublicense,
+and/or sell copies of the Software, and to permit persons to whom the
+Software is furnished to do so, subject to the following conditions:
+ 
+The above copyright notice and this permission notice shall be included
+in all copies or substantial portions of the Software.
+ 
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ 
+IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT
+OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR
+THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+/**
+* Header file for the per-frame arena allocator of parsed IAB elements.
+*
+* @file
+*/
+
+#ifndef __IABFRAMEARENA_H__
+#define	__IABFRAMEARENA_H__
+
+#include <stddef.h>
+#include <vector>
+
+#include "IABDataTypes.h"
+
+namespace SMPTE
+{
+namespace ImmersiveAudioBitstream
+{
+	/**
+	* @brief Arena for the element graph of one parsed IABFrame.
+	*
+	* Elements parsed into a frame are allocated from the arena by bumping a pointer through
+	* a few large blocks, so that one frame's elements sit together in memory and are released
+	* in one Reset(), instead of one heap allocation and free per element. Blocks are kept
+	* across Reset(), so a recycled frame parses without going back to the heap for its elements.
+	*
+	* The arena is selected for a parser with IABParserInterface::Create(..., kIABFrameAllocator_Arena).
+	* It is owned by the frame, see IABFrame::EnableArena().
+	*
+	*/
+	class IABFrameArena
+	{
+	public:
+
+		// Constructor
+		IABFrameArena();
+
+		// Destructor, releases all blocks
+		~IABFrameArena();
+
+		// Allocate iSize bytes, aligned to kAlignment
+		void* Allocate(size_t iSize);
+
+		// Release all allocations at once, keeping blocks for re-use
+		void Reset();
+
+		// Get number of bytes allocated since construction or last Reset()
+		size_t GetBytesAllocated() const;
+
+		// Arena that IABFrameArenaObject allocations are currently taken from, nullptr for the heap
+		static IABFrameArena* GetCurrent();
+
+		/**
+		* Selects the current arena for the calling thread, for the lifetime of the scope.
+		* The previous arena is restored on exit.
+		*
+		*/
+		class Scope
+		{
+		public:
+			Scope(IABFrameArena* iArena);
+			~Scope();
+
+		private:
+			IABFrameArena* previous_;
+		};
+
+		// Alignment of all allocations
+		static const size_t kAlignment = 16;
+
+		// Default block size, large enough to hold the elements of most frames
+		static const size_t kBlockSize = 64 * 1024;
+
+	private:
+
+		// Not copyable
+		IABFrameArena(const IABFrameArena&);
+		IABFrameArena& operator=(const IABFrameArena&);
+
+		struct Block
+		{
+			uint8_t* data_;
+			size_t size_;
+		};
+
+		// Blocks, in the order they are filled
+		std::vector<Block> blocks_;
+
+		// Block currently allocated from, and offset of its first free byte
+		size_t currentBlock_;
+		size_t currentOffset_;
+
+		// Bytes allocated since construction or last Reset()
+		size_t bytesAllocated_;
+	};
+
+	/**
+	* @brief Base class for parsed element types allocated from the current IABFrameArena.
+	*
+	* Class-specific operator new takes memory from IABFrameArena::GetCurrent() when one is set,
+	* and from the heap otherwise. Each allocation records its source, so that objects can be deleted
+	* as usual: operator delete frees heap allocations and leaves arena allocations to the arena.
+	* Destructors always run, as elements own containers allocated from the heap.
+	*
+	* An object allocated from an arena lives no longer than the arena, so its ownership cannot be
+	* handed over to a caller, see IsArenaAllocated().
+	*
+	*/
+	class IABFrameArenaObject
+	{
+	public:
+
+		static void* operator new(size_t iSize);
+		static void operator delete(void* iObject);
+
+		// Is the object at iObject allocated from an arena? iObject is the address of the complete
+		// object, as returned by operator new, that is dynamic_cast<const void*>() of a polymorphic object.
+		static bool IsArenaAllocated(const void* iObject);
+
+	protected:
+
+		IABFrameArenaObject() {}
+		~IABFrameArenaObject() {}
+	};
+
+} // namespace ImmersiveAudioBitstream
+} // namespace SMPTE
+
+#endif // __IABFRAMEARENA_H__
@@ -0,0 +1,523 @@
+/* Copyright (c) 2020 Xperi Corporation (and its subsidiaries). All rights reserved.
+ 
+Permission is hereby granted, free of charge, to any person obtaining
+a copy of this software and associated documentation files (the "Software"),
+to deal in the Software without restriction, including without limitation
+the rights to use, copy, modify, merge, publish, distribute, sublicense,
+and/or sell copies of the Software, and to permit persons to whom the
+Software is furnished to do so, subject to the following conditions:
+ 
+The above copyright notice and this permission notice shall be included
+in all copies or substantial portions of the Software.
+ 
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ 
+IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT
+OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR
+THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+
+/**
+* IAB frame index Implementation
+*
+* @file
+*/
+
+#include <string.h>
+#include <algorithm>
+#include <limits>
+
+#include "IABDataTypes.h"
+#include "IABFrameIndex.h"
+
+#ifdef USE_MDA_NULLPTR
+/* support lack of nullptr on older C++ compilers such as g++-4.4.7 */
+#include "nullptrOldCompilers.h"
+#endif
+
+namespace SMPTE
+{
+namespace ImmersiveAudioBitstream
+{
+	// Size of a subframe header: 8-bit tag, followed by 32-bit length
+	static const uint32_t kIABSubframeHeaderSize = 5;
+
+	// Sidecar layout, all fields big endian:
+	// "IABFIDX" and a version byte, 64-bit bitstream size, 64-bit bitstream fingerprint, 32-bit frame
+	// count, then for each frame, 64-bit offset and 32-bit size.
+	static const char kIABFrameIndexSidecarID[8] = { 'I', 'A', 'B', 'F', 'I', 'D', 'X', 2 };
+	static const uint32_t kIABFrameIndexSidecarHeaderSize = 28;
+	static const uint32_t kIABFrameIndexSidecarEntrySize = 12;
+
+	// Smallest frame: empty preamble, and an IA subframe of at least 1 byte
+	static const uint32_t kIABMinimumFrameSize = 2 * kIABSubframeHeaderSize + 1;
+
+	// The bitstream fingerprint is a 64-bit FNV-1a hash of the first and last bytes of the bitstream,
+	// that is the head of the first frame and the end of the last one
+	static const uint32_t kIABFrameIndexFingerprintSize = 4096;
+	static const uint64_t kFNV64OffsetBasis = 0xCBF29CE484222325ULL;
+	static const uint64_t kFNV64Prime = 0x100000001B3ULL;
+
+	// Big endian field packing for the sidecar
+	static void PackUInt(uint8_t* oData, uint64_t iValue, uint32_t iSize)
+	{
+		for (uint32_t i = 0; i < iSize; i++)
+		{
+			oData[i] = static_cast<uint8_t>(iValue >> (8 * (iSize - 1 - i)));
+		}
+	}
+
+	static uint64_t UnpackUInt(const uint8_t* iData, uint32_t iSize)
+	{
+		uint64_t value = 0;
+
+		for (uint32_t i = 0; i < iSize; i++)
+		{
+			value = (value << 8) | iData[i];
+		}
+
+		return value;
+	}
+
+	// Bitstream sources for IABFrameIndex::BuildIndex(), reading subframe headers at a given offset
+	class IABFrameIndexBufferSource
+	{
+	public:
+
+		IABFrameIndexBufferSource(const char* iBuffer, uint64_t iSize) : buffer_(iBuffer), size_(iSize) {}
+
+		uint64_t GetSize() const { return size_; }
+
+		// iOffset + iSize is within GetSize()
+		bool ReadAt(uint64_t iOffset, uint8_t* oData, uint32_t iSize)
+		{
+			memcpy(oData, buffer_ + iOffset, iSize);
+			return true;
+		}
+
+	private:
+
+		const char* buffer_;
+		uint64_t size_;
+	};
+
+	class IABFrameIndexStreamSource
+	{
+	public:
+
+		IABFrameIndexStreamSource(std::istream* iStream, std::streampos iStart, uint64_t iSize) : stream_(iStream), start_(iStart), size_(iSize) {}
+
+		uint64_t GetSize() const { return size_; }
+
+		// iOffset + iSize is within GetSize()
+		bool ReadAt(uint64_t iOffset, uint8_t* oData, uint32_t iSize)
+		{
+			stream_->seekg(start_ + static_cast<std::streamoff>(iOffset));
+			stream_->read(reinterpret_cast<char*>(oData), iSize);
+
+			return (stream_->gcount() == static_cast<std::streamsize>(iSize));
+		}
+
+	private:
+
+		std::istream* stream_;
+		std::streampos start_;
+		uint64_t size_;
+	};
+
+	// Fingerprint of the bitstream read through iSource, see kIABFrameIndexFingerprintSize
+	template<typename SourceType>
+	static bool ComputeFingerprint(SourceType& iSource, uint64_t& oFingerprint)
+	{
+		uint64_t size = iSource.GetSize();
+		uint32_t spanSize = static_cast<uint32_t>(std::min<uint64_t>(size, kIABFrameIndexFingerprintSize));
+		uint64_t spanOffsets[2] = { 0, size - spanSize };
+		std::vector<uint8_t> span(spanSize);
+
+		oFingerprint = kFNV64OffsetBasis;
+
+		for (uint32_t n = 0; (n < 2) && (spanSize > 0); n++)
+		{
+			if (!iSource.ReadAt(spanOffsets[n], &span[0], spanSize))
+			{
+				return false;
+			}
+
+			for (uint32_t i = 0; i < spanSize; i++)
+			{
+				oFingerprint = (oFingerprint ^ span[i]) * kFNV64Prime;
+			}
+		}
+
+		return true;
+	}
+
+	// Start position and size of the bitstream from the current position of iStream to its end.
+	// iStream is left at the start position.
+	static bool GetStreamExtent(std::istream* iStream, std::streampos& oStart, uint64_t& oSize)
+	{
+		oStart = iStream->tellg();
+		iStream->seekg(0, std::ios_base::end);
+		std::streampos end = iStream->tellg();
+
+		iStream->clear();
+		iStream->seekg(oStart);
+
+		if ((oStart < 0) || (end < oStart))
+		{
+			return false;
+		}
+
+		oSize = static_cast<uint64_t>(end - oStart);
+
+		return true;
+	}
+
+	// ****************************************************************************
+	// Factory methods for creating instances of IABFrameIndex
+	// ****************************************************************************
+
+	// Create IABFrameIndex instance
+	IABFrameIndexInterface* IABFrameIndexInterface::Create()
+	{
+		return new IABFrameIndex();
+	}
+
+	// Deletes an IABFrameIndex instance
+	void IABFrameIndexInterface::Delete(IABFrameIndexInterface* iInstance)
+	{
+		delete iInstance;
+	}
+
+	/****************************************************************************
+	*
+	* IABFrameIndex
+	*
+	*****************************************************************************/
+
+	IABFrameIndex::IABFrameIndex()
+	{
+		bitstreamSize_ = 0;
+		bitstreamFingerprint_ = 0;
+	}
+
+	IABFrameIndex::~IABFrameIndex()
+	{
+	}
+
+	// IABFrameIndex::Build() implementation, in-memory bitstream
+	iabError IABFrameIndex::Build(const char* iInputBuffer, uint64_t iInputBufferSize)
+	{
+		frames_.clear();
+		bitstreamSize_ = 0;
+		bitstreamFingerprint_ = 0;
+
+		if ((nullptr == iInputBuffer) && (iInputBufferSize > 0))
+		{
+			return kIABBadArgumentsError;
+		}
+
+		IABFrameIndexBufferSource source(iInputBuffer, iInputBufferSize);
+
+		return BuildIndex(source);
+	}
+
+	// IABFrameIndex::Build() implementation, seekable stream
+	iabError IABFrameIndex::Build(std::istream* iInputStream)
+	{
+		frames_.clear();
+		bitstreamSize_ = 0;
+		bitstreamFingerprint_ = 0;
+
+		if (nullptr == iInputStream)
+		{
+			return kIABBadArgumentsError;
+		}
+
+		// Bitstream size, from the current position to the end of the stream
+		std::streampos start;
+		uint64_t size = 0;
+
+		if (!GetStreamExtent(iInputStream, start, size))
+		{
+			return kIABSystemIOError;
+		}
+
+		IABFrameIndexStreamSource source(iInputStream, start, size);
+		iabError errorCode = BuildIndex(source);
+
+		iInputStream->clear();
+		iInputStream->seekg(start);
+
+		return errorCode;
+	}
+
+	// IABFrameIndex::BuildIndex() implementation
+	template<typename SourceType>
+	iabError IABFrameIndex::BuildIndex(SourceType& iSource)
+	{
+		uint64_t size = iSource.GetSize();
+		uint64_t offset = 0;
+		uint8_t header[kIABSubframeHeaderSize];
+
+		bitstreamSize_ = size;
+
+		if (!ComputeFingerprint(iSource, bitstreamFingerprint_))
+		{
+			return kIABSystemIOError;
+		}
+
+		// Frames follow each other to the end of the bitstream. Subframe checks mirror IABPreamble
+		// and IABIASubFrame DeSerialize().
+		while (offset < size)
+		{
+			// Preamble subframe, mandatory, possibly empty
+			if ((size - offset) < kIABSubframeHeaderSize)
+			{
+				return kIABParserEndOfStreamReached;
+			}
+
+			if (!iSource.ReadAt(offset, header, kIABSubframeHeaderSize))
+			{
+				return kIABSystemIOError;
+			}
+
+			if (kIABContainerSubFrameTag_Preamble != header[0])
+			{
+				return kIABParserMissingPreambleError;
+			}
+
+			uint64_t iaSubframeOffset = offset + kIABSubframeHeaderSize + UnpackUInt(&header[1], 4);
+
+			// IA subframe, holding the IAB frame element
+			if ((iaSubframeOffset > size) || ((size - iaSubframeOffset) < kIABSubframeHeaderSize))
+			{
+				return kIABParserEndOfStreamReached;
+			}
+
+			if (!iSource.ReadAt(iaSubframeOffset, header, kIABSubframeHeaderSize))
+			{
+				return kIABSystemIOError;
+			}
+
+			uint64_t iaSubframeLength = UnpackUInt(&header[1], 4);
+
+			if ((kIABContainerSubFrameTag_IAFrame != header[0]) || (0 == iaSubframeLength))
+			{
+				return kIABParserIASubFrameHeaderError;
+			}
+
+			uint64_t frameEnd = iaSubframeOffset + kIABSubframeHeaderSize + iaSubframeLength;
+
+			if (frameEnd > size)
+			{
+				return kIABParserEndOfStreamReached;
+			}
+
+			// Frames are parsed from a buffer of up to 4GB, see IABParserInterface::ParseIABFrame()
+			if ((frameEnd - offset) > std::numeric_limits<uint32_t>::max())
+			{
+				return kIABParserIASubFrameHeaderError;
+			}
+
+			IABFrameIndexEntry frame;
+			frame.frameOffset_ = offset;
+			frame.frameSize_ = static_cast<uint32_t>(frameEnd - offset);
+			frames_.push_back(frame);
+
+			offset = frameEnd;
+		}
+
+		return kIABNoError;
+	}
+
+	// IABFrameIndex::GetFrameCount() implementation
+	uint32_t IABFrameIndex::GetFrameCount() const
+	{
+		return static_cast<uint32_t>(frames_.size());
+	}
+
+	// IABFrameIndex::GetFrame() implementation
+	iabError IABFrameIndex::GetFrame(uint32_t iFrameNumber, IABFrameIndexEntry& oFrame) const
+	{
+		if (iFrameNumber >= frames_.size())
+		{
+			return kIABBadArgumentsError;
+		}
+
+		oFrame = frames_[iFrameNumber];
+
+		return kIABNoError;
+	}
+
+	// IABFrameIndex::GetFrames() implementation
+	const std::vector<IABFrameIndexEntry>& IABFrameIndex::GetFrames() const
+	{
+		return frames_;
+	}
+
+	// IABFrameIndex::GetBitstreamSize() implementation
+	uint64_t IABFrameIndex::GetBitstreamSize() const
+	{
+		return bitstreamSize_;
+	}
+
+	// IABFrameIndex::Write() implementation
+	iabError IABFrameIndex::Write(std::ostream& oSidecar) const
+	{
+		uint8_t header[kIABFrameIndexSidecarHeaderSize];
+
+		memcpy(header, kIABFrameIndexSidecarID, sizeof(kIABFrameIndexSidecarID));
+		PackUInt(&header[8], bitstreamSize_, 8);
+		PackUInt(&header[16], bitstreamFingerprint_, 8);
+		PackUInt(&header[24], frames_.size(), 4);
+		oSidecar.write(reinterpret_cast<const char*>(header), kIABFrameIndexSidecarHeaderSize);
+
+		// Entries are written in chunks, rather than one small write() each
+		const uint32_t kChunkFrameCount = 1024;
+		uint8_t chunk[kChunkFrameCount * kIABFrameIndexSidecarEntrySize];
+		uint32_t chunkFrameCount = 0;
+
+		for (std::vector<IABFrameIndexEntry>::const_iterator iter = frames_.begin(); iter != frames_.end(); iter++)
+		{
+			uint8_t* entry = &chunk[chunkFrameCount * kIABFrameIndexSidecarEntrySize];
+			PackUInt(entry, iter->frameOffset_, 8);
+			PackUInt(entry + 8, iter->frameSize_, 4);
+
+			if (++chunkFrameCount == kChunkFrameCount)
+			{
+				oSidecar.write(reinterpret_cast<const char*>(chunk), chunkFrameCount * kIABFrameIndexSidecarEntrySize);
+				chunkFrameCount = 0;
+			}
+		}
+
+		oSidecar.write(reinterpret_cast<const char*>(chunk), chunkFrameCount * kIABFrameIndexSidecarEntrySize);
+
+		return oSidecar.good() ? kIABNoError : kIABSystemIOError;
+	}
+
+	// IABFrameIndex::Read() implementation, in-memory bitstream
+	iabError IABFrameIndex::Read(std::istream& iSidecar, const char* iInputBuffer, uint64_t iInputBufferSize)
+	{
+		frames_.clear();
+		bitstreamSize_ = 0;
+		bitstreamFingerprint_ = 0;
+
+		if ((nullptr == iInputBuffer) && (iInputBufferSize > 0))
+		{
+			return kIABBadArgumentsError;
+		}
+
+		IABFrameIndexBufferSource source(iInputBuffer, iInputBufferSize);
+
+		return ReadIndex(iSidecar, source);
+	}
+
+	// IABFrameIndex::Read() implementation, seekable stream
+	iabError IABFrameIndex::Read(std::istream& iSidecar, std::istream* iInputStream)
+	{
+		frames_.clear();
+		bitstreamSize_ = 0;
+		bitstreamFingerprint_ = 0;
+
+		if (nullptr == iInputStream)
+		{
+			return kIABBadArgumentsError;
+		}
+
+		std::streampos start;
+		uint64_t size = 0;
+
+		if (!GetStreamExtent(iInputStream, start, size))
+		{
+			return kIABSystemIOError;
+		}
+
+		IABFrameIndexStreamSource source(iInputStream, start, size);
+		iabError errorCode = ReadIndex(iSidecar, source);
+
+		iInputStream->clear();
+		iInputStream->seekg(start);
+
+		return errorCode;
+	}
+
+	// IABFrameIndex::ReadIndex() implementation
+	template<typename SourceType>
+	iabError IABFrameIndex::ReadIndex(std::istream& iSidecar, SourceType& iSource)
+	{
+		uint8_t header[kIABFrameIndexSidecarHeaderSize];
+		iSidecar.read(reinterpret_cast<char*>(header), kIABFrameIndexSidecarHeaderSize);
+
+		if (iSidecar.gcount() != kIABFrameIndexSidecarHeaderSize)
+		{
+			return kIABParserFrameIndexError;
+		}
+
+		uint64_t bitstreamSize = UnpackUInt(&header[8], 8);
+		uint64_t bitstreamFingerprint = UnpackUInt(&header[16], 8);
+		uint32_t frameCount = static_cast<uint32_t>(UnpackUInt(&header[24], 4));
+
+		if ((0 != memcmp(header, kIABFrameIndexSidecarID, sizeof(kIABFrameIndexSidecarID)))
+			|| (bitstreamSize != iSource.GetSize())
+			|| (frameCount > (bitstreamSize / kIABMinimumFrameSize)))
+		{
+			return kIABParserFrameIndexError;
+		}
+
+		// A bitstream of the same size, but rewritten since the sidecar was, is spotted by its fingerprint
+		uint64_t fingerprint = 0;
+
+		if (!ComputeFingerprint(iSource, fingerprint))
+		{
+			return kIABSystemIOError;
+		}
+
+		if (fingerprint != bitstreamFingerprint)
+		{
+			return kIABParserFrameIndexError;
+		}
+
+		std::vector<IABFrameIndexEntry> frames;
+		frames.reserve(frameCount);
+
+		// Frames must follow each other from the start of the bitstream, as found by Build()
+		uint64_t offset = 0;
+		uint8_t entry[kIABFrameIndexSidecarEntrySize];
+
+		for (uint32_t i = 0; i < frameCount; i++)
+		{
+			iSidecar.read(reinterpret_cast<char*>(entry), kIABFrameIndexSidecarEntrySize);
+
+			if (iSidecar.gcount() != kIABFrameIndexSidecarEntrySize)
+			{
+				return kIABParserFrameIndexError;
+			}
+
+			IABFrameIndexEntry frame;
+			frame.frameOffset_ = UnpackUInt(entry, 8);
+			frame.frameSize_ = static_cast<uint32_t>(UnpackUInt(entry + 8, 4));
+
+			if ((frame.frameOffset_ != offset) || (frame.frameSize_ < kIABMinimumFrameSize)
+				|| (frame.frameSize_ > (bitstreamSize - offset)))
+			{
+				return kIABParserFrameIndexError;
+			}
+
+			offset += frame.frameSize_;
+			frames.push_back(frame);
+		}
+
+		frames_.swap(frames);
+		bitstreamSize_ = bitstreamSize;
+		bitstreamFingerprint_ = bitstreamFingerprint;
+
+		return kIABNoError;
+	}
+
+} // namespace ImmersiveAudioBitstream
+} // namespace SMPTE
@@ -0,0 +1,138 @@
+/* Copyright (c) 2020 Xperi Corporation (and its subsidiaries). All rights reserved.
+ 
+Permission is hereby granted, free of charge, to any person obtaining
+a copy of this software and associated documentation files (the "Software"),
+to deal in the Software without restriction, including without limitation
+the rights to use, copy, modify, merge, publish, distribute, sublicense,
+and/or sell copies of the Software, and to permit persons to whom the
+Software is furnished to do so, subject to the following conditions:
+ 
+The above copyright notice and this permission notice shall be included
+in all copies or substantial portions of the Software.
+ 
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ 
+IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT
+OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR
+THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+
+/**
+ * Header file for the IAB frame index implementation.
+ *
+ * @file
+ */
+
+#ifndef __IABFRAMEINDEX_H__
+#define	__IABFRAMEINDEX_H__
+
+#include "IABElementsAPI.h"
+#include "IABParserAPI.h"
+
+namespace SMPTE
+{
+namespace ImmersiveAudioBitstream
+{
+    /**
+     *
+     * Index of the frames of a single-file IA bitstream, built from subframe tags and lengths.
+     *
+     */
+    
+    class IABFrameIndex : public IABFrameIndexInterface
+    {
+    public:
+
+		// Constructor
+		IABFrameIndex();
+
+		// Destructor
+		~IABFrameIndex();
+
+		/** Builds the index of an in-memory IA bitstream
+		*
+		* @sa IABFrameIndexInterface
+		*
+		*/
+		iabError Build(const char* iInputBuffer, uint64_t iInputBufferSize);
+
+		/** Builds the index of an IA bitstream read from a seekable stream
+		*
+		* @sa IABFrameIndexInterface
+		*
+		*/
+		iabError Build(std::istream* iInputStream);
+
+		/** Gets number of frames in the index
+		*
+		* @sa IABFrameIndexInterface
+		*
+		*/
+		uint32_t GetFrameCount() const;
+
+		/** Gets offset and size of a frame
+		*
+		* @sa IABFrameIndexInterface
+		*
+		*/
+		iabError GetFrame(uint32_t iFrameNumber, IABFrameIndexEntry& oFrame) const;
+
+		/** Gets the frame table
+		*
+		* @sa IABFrameIndexInterface
+		*
+		*/
+		const std::vector<IABFrameIndexEntry>& GetFrames() const;
+
+		/** Gets size of the indexed bitstream
+		*
+		* @sa IABFrameIndexInterface
+		*
+		*/
+		uint64_t GetBitstreamSize() const;
+
+		/** Writes the index to a sidecar
+		*
+		* @sa IABFrameIndexInterface
+		*
+		*/
+		iabError Write(std::ostream& oSidecar) const;
+
+		/** Reads the index of an in-memory IA bitstream from a sidecar
+		*
+		* @sa IABFrameIndexInterface
+		*
+		*/
+		iabError Read(std::istream& iSidecar, const char* iInputBuffer, uint64_t iInputBufferSize);
+
+		/** Reads the index of an IA bitstream read from a seekable stream from a sidecar
+		*
+		* @sa IABFrameIndexInterface
+		*
+		*/
+		iabError Read(std::istream& iSidecar, std::istream* iInputStream);
+
+    private:
+
+		// Walk the frames of the bitstream read through iSource, see IABFrameIndex.cpp for source types
+		template<typename SourceType> iabError BuildIndex(SourceType& iSource);
+
+		// Read the index from iSidecar, checking it against the bitstream read through iSource
+		template<typename SourceType> iabError ReadIndex(std::istream& iSidecar, SourceType& iSource);
+
+		// Frame table, in bitstream order
+		std::vector<IABFrameIndexEntry> frames_;
+
+		// Size of the indexed bitstream, in bytes, and its fingerprint, see IABFrameIndex.cpp
+		uint64_t bitstreamSize_;
+		uint64_t bitstreamFingerprint_;
+	};
+
+} // namespace ImmersiveAudioBitstream
+} // namespace SMPTE
+
+#endif // __IABFRAMEINDEX_H__
@@ -30,6 +30,7 @@ THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #include <stack>
 #include <vector>
 #include <stdlib.h>
+#include <limits>
 
 #include "IABDataTypes.h"
 #include "IABElements.h"
@@ -52,7 +53,7 @@ namespace ImmersiveAudioBitstream
 	// ****************************************************************************
 
 	// Create IABParser instance
-	IABParserInterface* IABParserInterface::Create(std::istream* iInputStream)
+	IABParserInterface* IABParserInterface::Create(std::istream* iInputStream, IABFrameAllocatorType iFrameAllocator)
 	{
         if (nullptr == iInputStream)
         {
@@ -60,14 +61,27 @@ namespace ImmersiveAudioBitstream
         }
         
 		IABParser* iabParser = nullptr;
-		iabParser = new IABParser(iInputStream);
+		iabParser = new IABParser(iInputStream, iFrameAllocator);
+		return iabParser;
+	}
+
+	// Create IABParser instance on an in-memory IAB data stream
+	IABParserInterface* IABParserInterface::Create(const char* iInputBuffer, uint64_t iInputBufferSize, IABFrameAllocatorType iFrameAllocator)
+	{
+        if ((nullptr == iInputBuffer) || (0 == iInputBufferSize))
+        {
+            return nullptr;
+        }
+
+		IABParser* iabParser = nullptr;
+		iabParser = new IABParser(iInputBuffer, iInputBufferSize, iFrameAllocator);
 		return iabParser;
 	}
 
 	// Create IABParser instance without associated IAB data stream
-	IABParserInterface* IABParserInterface::Create()
+	IABParserInterface* IABParserInterface::Create(IABFrameAllocatorType iFrameAllocator)
 	{
-		IABParser* iabParser = new IABParser();
+		IABParser* iabParser = new IABParser(iFrameAllocator);
 		return iabParser;
 	}
 
@@ -83,18 +97,55 @@ namespace ImmersiveAudioBitstream
     *
     *****************************************************************************/
 
-	IABParser::IABParser(std::istream* iInputStream)
+	IABParser::IABParser(std::istream* iInputStream, IABFrameAllocatorType iFrameAllocator)
 	{
 		iabStream_ = iInputStream;
+		iabBuffer_ = nullptr;
+		iabBufferSize_ = 0;
+		iabBufferOffset_ = 0;
+		parsedFrameSize_ = 0;
 		iabParserFrame_ = nullptr;
 		unAllowedFrameSubElementsCount_ = 0;
+		frameRecycling_ = false;
+		parsedFrameRecyclable_ = false;
+		frameAllocator_ = iFrameAllocator;
+		lazyAudioDataParsing_ = false;
+		frameHeaderOnlyParsing_ = false;
+		preamblePayloadParsing_ = kIABPreamblePayload_Copy;
 	}
 
-	IABParser::IABParser()
+	IABParser::IABParser(const char* iInputBuffer, uint64_t iInputBufferSize, IABFrameAllocatorType iFrameAllocator)
 	{
 		iabStream_ = nullptr;
+		iabBuffer_ = iInputBuffer;
+		iabBufferSize_ = iInputBufferSize;
+		iabBufferOffset_ = 0;
+		parsedFrameSize_ = 0;
 		iabParserFrame_ = nullptr;
 		unAllowedFrameSubElementsCount_ = 0;
+		frameRecycling_ = false;
+		parsedFrameRecyclable_ = false;
+		frameAllocator_ = iFrameAllocator;
+		lazyAudioDataParsing_ = false;
+		frameHeaderOnlyParsing_ = false;
+		preamblePayloadParsing_ = kIABPreamblePayload_Copy;
+	}
+
+	IABParser::IABParser(IABFrameAllocatorType iFrameAllocator)
+	{
+		iabStream_ = nullptr;
+		iabBuffer_ = nullptr;
+		iabBufferSize_ = 0;
+		iabBufferOffset_ = 0;
+		parsedFrameSize_ = 0;
+		iabParserFrame_ = nullptr;
+		unAllowedFrameSubElementsCount_ = 0;
+		frameRecycling_ = false;
+		parsedFrameRecyclable_ = false;
+		frameAllocator_ = iFrameAllocator;
+		lazyAudioDataParsing_ = false;
+		frameHeaderOnlyParsing_ = false;
+		preamblePayloadParsing_ = kIABPreamblePayload_Copy;
 	}
 
 	IABParser::~IABParser()
@@ -132,32 +183,49 @@ namespace ImmersiveAudioBitstream
     // Parse an IAB frame
     iabError IABParser::ParseIABFrame()
     {
-		// Save existing frame pointer, decide whether delete is needed later
-		IABFrameInterface* olderParsedFrame = iabParserFrame_;
+		IABFrame* recyclableFrame = GetRecyclableFrame();
+		parsedFrameSize_ = 0;
 
-		// Create/"new" IABFrameInterface instance for the frame to be parsed in..
-		// (This sequence forces instance to be created at a different address, though less optimised.)
-		iabParserFrame_ = IABFrameInterface::Create(iabStream_);
+		if (nullptr == iabBuffer_)
+		{
+			if ((nullptr != recyclableFrame) && (kIABNoError == recyclableFrame->Recycle()))
+			{
+				return DeSerializeFrame(recyclableFrame, false);
+			}
+
+			// Create/"new" IABFrameInterface instance for the frame to be parsed in..
+			// (This sequence forces instance to be created at a different address, though less optimised.)
+			return DeSerializeFrame(IABFrameInterface::Create(iabStream_), false);
+		}
 
-		if (nullptr == iabParserFrame_)
+		// In-memory bitstream: parse the next frame in place
+		if (iabBufferOffset_ >= iabBufferSize_)
 		{
-			return kIABMemoryError;
+			return kIABParserEndOfStreamReached;
 		}
 
-		// Now delete the old parsed frame object to avoid memory leak if necessary
-		if (nullptr != olderParsedFrame)
+		uint64_t remainingSize = iabBufferSize_ - iabBufferOffset_;
+
+		if (remainingSize > std::numeric_limits<uint32_t>::max())
 		{
-			IABFrameInterface::Delete(olderParsedFrame);
+			remainingSize = std::numeric_limits<uint32_t>::max();
 		}
-        
-		// Parse        
-        iabError returnCode = kIABNoError;
-        returnCode = iabParserFrame_->DeSerialize();
 
-		// Update total number of unallowed + undefined frame subelements encountered during parsing
-		// Cumulative over frames.
-		unAllowedFrameSubElementsCount_ += iabParserFrame_->GetNumUnallowedSubElements();
-		unAllowedFrameSubElementsCount_ += iabParserFrame_->GetNumUndefinedSubElements();
+		iabError returnCode = kIABNoError;
+
+		// The bitstream buffer outlives the frame, audio data and preamble payload may point into it
+		if ((nullptr != recyclableFrame) && (kIABNoError == recyclableFrame->Recycle(iabBuffer_ + iabBufferOffset_, static_cast<uint32_t>(remainingSize))))
+		{
+			returnCode = DeSerializeFrame(recyclableFrame, true);
+		}
+		else
+		{
+			returnCode = DeSerializeFrame(IABFrameInterface::Create(iabBuffer_ + iabBufferOffset_, static_cast<uint32_t>(remainingSize)), true);
+		}
+
+		// Move on to the next frame
+		UpdateParsedFrameSize();
+		iabBufferOffset_ += parsedFrameSize_;
 
         return returnCode;
     }
@@ -171,19 +239,87 @@ namespace ImmersiveAudioBitstream
 			return kIABBadArgumentsError;
 		}
 
+		// Parse in place from the caller's buffer, which is only borrowed for this call
+		IABFrame* recyclableFrame = GetRecyclableFrame();
+
 		iabError returnCode = kIABNoError;
 
-		iabStream_ = new std::istringstream(std::string(iIABFrameDataBuffer, iBufferSize));
+		if ((nullptr != recyclableFrame) && (kIABNoError == recyclableFrame->Recycle(iIABFrameDataBuffer, iBufferSize)))
+		{
+			returnCode = DeSerializeFrame(recyclableFrame, false);
+		}
+		else
+		{
+			returnCode = DeSerializeFrame(IABFrameInterface::Create(iIABFrameDataBuffer, iBufferSize), false);
+		}
+
+		UpdateParsedFrameSize();
+
+		return returnCode;
+	}
 
-		if (!iabStream_)
+	// Record size of the frame just parsed from memory
+	void IABParser::UpdateParsedFrameSize()
+	{
+		IABFrame* parsedFrame = dynamic_cast<IABFrame*>(iabParserFrame_);
+
+		parsedFrameSize_ = (nullptr != parsedFrame) ? parsedFrame->GetBufferBytesParsed() : 0;
+	}
+
+	// Get the parsed frame, if it is to be recycled
+	IABFrame* IABParser::GetRecyclableFrame()
+	{
+		if (!frameRecycling_ || !parsedFrameRecyclable_ || (nullptr == iabParserFrame_))
 		{
-			return kIABBadArgumentsError;
+			return nullptr;
+		}
+
+		return dynamic_cast<IABFrame*>(iabParserFrame_);
+	}
+
+	// Replace the parsed frame with iNewFrame and parse it
+	iabError IABParser::DeSerializeFrame(IABFrameInterface* iNewFrame, bool iFrameBufferKept)
+	{
+		if (nullptr == iNewFrame)
+		{
+			return kIABMemoryError;
+		}
+
+		// Now delete the old parsed frame object to avoid memory leak if necessary,
+		// unless it is being recycled
+		if ((nullptr != iabParserFrame_) && (iNewFrame != iabParserFrame_))
+		{
+			IABFrameInterface::Delete(iabParserFrame_);
+		}
+
+		iabParserFrame_ = iNewFrame;
+
+		IABFrame* parsedFrame = dynamic_cast<IABFrame*>(iabParserFrame_);
+
+		if (nullptr != parsedFrame)
+		{
+			if (kIABFrameAllocator_Arena == frameAllocator_)
+			{
+				parsedFrame->EnableArena();
+			}
+
+			parsedFrame->SetLazyAudioData(lazyAudioDataParsing_, iFrameBufferKept);
+			parsedFrame->SetHeaderOnly(frameHeaderOnlyParsing_);
+			parsedFrame->SetPreamblePayloadParsing(kIABPreamblePayload_Skip == preamblePayloadParsing_,
+				(kIABPreamblePayload_Borrow == preamblePayloadParsing_) && iFrameBufferKept);
 		}
 
-		returnCode = ParseIABFrame();
+		// Parse        
+		iabError returnCode = kIABNoError;
+		returnCode = iabParserFrame_->DeSerialize();
 
-		delete iabStream_;
-		iabStream_ = NULL;
+		// Readers may be left mid-frame on errors, start afresh on the next frame
+		parsedFrameRecyclable_ = (kIABNoError == returnCode);
+
+		// Update total number of unallowed + undefined frame subelements encountered during parsing
+		// Cumulative over frames.
+		unAllowedFrameSubElementsCount_ += iabParserFrame_->GetNumUnallowedSubElements();
+		unAllowedFrameSubElementsCount_ += iabParserFrame_->GetNumUndefinedSubElements();
 
 		return returnCode;
 	}
@@ -216,6 +352,45 @@ namespace ImmersiveAudioBitstream
 		return kIABParserNoParsedFrameError;
 	}
 
+	iabError IABParser::SetFrameRecycling(bool iEnable)
+	{
+		frameRecycling_ = iEnable;
+
+		return kIABNoError;
+	}
+
+	iabError IABParser::SetLazyAudioDataParsing(bool iEnable)
+	{
+		lazyAudioDataParsing_ = iEnable;
+
+		return kIABNoError;
+	}
+
+	iabError IABParser::SetFrameHeaderOnlyParsing(bool iEnable)
+	{
+		frameHeaderOnlyParsing_ = iEnable;
+
+		return kIABNoError;
+	}
+
+	iabError IABParser::SetPreamblePayloadParsing(IABPreamblePayloadParsingType iPayloadParsing)
+	{
+		if ((kIABPreamblePayload_Copy != iPayloadParsing) && (kIABPreamblePayload_Borrow != iPayloadParsing)
+			&& (kIABPreamblePayload_Skip != iPayloadParsing))
+		{
+			return kIABBadArgumentsError;
+		}
+
+		preamblePayloadParsing_ = iPayloadParsing;
+
+		return kIABNoError;
+	}
+
+	uint64_t IABParser::GetParsedFrameSize() const
+	{
+		return parsedFrameSize_;
+	}
+
     IABSampleRateType IABParser::GetSampleRate()
     {
         IABSampleRateType sampleRate;
@@ -275,51 +450,50 @@ namespace ImmersiveAudioBitstream
         return maxRendered;
     }
 
-    iabError IABParser::GetAudioAssetFromDLC(IABAudioDataIDType iAudioDataID, uint32_t iNumSamples, int32_t *oAudioSamples)
-    {
-        if (nullptr == iabParserFrame_)
-        {
-            return kIABParserNoParsedFrameError;
-        }
+	// IABParser::GetAudioDataIDs() implementation
+	iabError IABParser::GetAudioDataIDs(std::vector<IABAudioDataIDType>& oAudioDataIDs)
+	{
+		IABFrame* parsedFrame = dynamic_cast<IABFrame*>(iabParserFrame_);
 
-        if ((nullptr == oAudioSamples) || (0 == iNumSamples))
-        {
-            return kIABBadArgumentsError;
-        }
-        
-        std::vector<IABElement*> frameSubElements;
-        std::vector<IABElement*>::const_iterator iterFSE;
-        IABAudioDataIDType audioDataID;
-        
-        iabParserFrame_->GetSubElements(frameSubElements);
-        IABAudioDataDLC *dlcElement = nullptr;
-        
-        for (iterFSE = frameSubElements.begin(); iterFSE != frameSubElements.end(); iterFSE++)
-        {
-            dlcElement = dynamic_cast<IABAudioDataDLC*>(*iterFSE);
-            if (dlcElement)
-            {
-                dlcElement->GetAudioDataID(audioDataID);
-                if (audioDataID == iAudioDataID)
-                {
-                    // found DLC element
-                    IABSampleRateType dlcSampleRate;
-                    dlcElement->GetDLCSampleRate(dlcSampleRate);
-
-                    if (kIABNoError != dlcElement->DecodeDLCToMonoPCM(oAudioSamples, iNumSamples, dlcSampleRate))
-                    {
-                        return kIABParserDLCDecodingError;
-                    }
-                    
-                    break;
-                }
-            }
-            
-        }
-        
-        return kIABNoError;
-        
-    }
+		if (nullptr == parsedFrame)
+		{
+			return kIABParserNoParsedFrameError;
+		}
+
+		parsedFrame->GetAudioDataIDs(oAudioDataIDs);
+
+		return kIABNoError;
+	}
+
+	// IABParser::DecodeAudioAsset() implementation
+	iabError IABParser::DecodeAudioAsset(IABAudioDataIDType iAudioDataID, int32_t* oAudioSamples, uint32_t iNumSamples)
+	{
+		IABFrame* parsedFrame = dynamic_cast<IABFrame*>(iabParserFrame_);
+
+		if (nullptr == parsedFrame)
+		{
+			return kIABParserNoParsedFrameError;
+		}
+
+		IABDLCCodecContext::Scope contextScope(&dlcCodecContext_);
+
+		return parsedFrame->DecodeAudioData(iAudioDataID, oAudioSamples, iNumSamples);
+	}
+
+	// IABParser::DecodeAllAudioAssets() implementation
+	iabError IABParser::DecodeAllAudioAssets(int32_t* const* oAudioSamples, uint32_t iNumAssets, uint32_t iNumSamples)
+	{
+		IABFrame* parsedFrame = dynamic_cast<IABFrame*>(iabParserFrame_);
+
+		if (nullptr == parsedFrame)
+		{
+			return kIABParserNoParsedFrameError;
+		}
+
+		IABDLCCodecContext::Scope contextScope(&dlcCodecContext_);
+
+		return parsedFrame->DecodeAllAudioData(oAudioSamples, iNumAssets, iNumSamples);
+	}
 
     const std::string& IABParser::getStringForErrorCode(commonErrorCodes iErrorCode)
     {
@@ -350,6 +524,7 @@ namespace ImmersiveAudioBitstream
         errorCodeMap[kIABParserIABObjectZone19Error] = "IABParser has encountered an error while parsing a IAB object definition zone19.\n";
         errorCodeMap[kIABParserIABAuthoringToolInfoError] = "IABParser has encountered an error while parsing the authoring tool information element.\n";
         errorCodeMap[kIABParserIABUserDataError] = "IABParser has encountered an error while parsing the user data element.\n";
+        errorCodeMap[kIABParserFrameIndexError] = "IABParser has been given a frame index sidecar that is malformed, or that does not match the bitstream.\n";
                 
         // ***********************
         // Validation related error
@@ -47,8 +47,9 @@ namespace ImmersiveAudioBitstream
     public:
 
 		// Constructor
-		IABParser(std::istream* iInputStream);
-		IABParser();
+		IABParser(std::istream* iInputStream, IABFrameAllocatorType iFrameAllocator);
+		IABParser(const char* iInputBuffer, uint64_t iInputBufferSize, IABFrameAllocatorType iFrameAllocator);
+		IABParser(IABFrameAllocatorType iFrameAllocator);
 
 		// Destructor
 		~IABParser();
@@ -102,6 +103,41 @@ namespace ImmersiveAudioBitstream
 		*/
 		iabError GetIABFrameReleased(IABFrameInterface*& oIABFrame);
 
+		/** Enables or disables frame recycling.
+		*
+		* @sa IABParserInterface
+		*
+		*/
+		iabError SetFrameRecycling(bool iEnable);
+
+		/** Enables or disables lazy parsing of audio data elements.
+		*
+		* @sa IABParserInterface
+		*
+		*/
+		iabError SetLazyAudioDataParsing(bool iEnable);
+
+		/** Enables or disables frame header only parsing.
+		*
+		* @sa IABParserInterface
+		*
+		*/
+		iabError SetFrameHeaderOnlyParsing(bool iEnable);
+
+		/** Sets how the preamble subframe payload of parsed frames is handled.
+		*
+		* @sa IABParserInterface
+		*
+		*/
+		iabError SetPreamblePayloadParsing(IABPreamblePayloadParsingType iPayloadParsing);
+
+		/** Gets the number of bitstream bytes taken up by the last frame parsed from memory.
+		*
+		* @sa IABParserInterface
+		*
+		*/
+		uint64_t GetParsedFrameSize() const;
+
 		/** Gets audio sample rate of IA bitstream
          *
          * @sa IABParserInterface
@@ -144,6 +180,27 @@ namespace ImmersiveAudioBitstream
          */
         IABMaxRenderedRangeType GetMaximumAssetsToBeRendered();
                 
+		/** Gets the AudioDataIDs of the audio assets of the parsed frame
+		*
+		* @sa IABParserInterface
+		*
+		*/
+		iabError GetAudioDataIDs(std::vector<IABAudioDataIDType>& oAudioDataIDs);
+
+		/** Decodes an audio asset of the parsed frame
+		*
+		* @sa IABParserInterface
+		*
+		*/
+		iabError DecodeAudioAsset(IABAudioDataIDType iAudioDataID, int32_t* oAudioSamples, uint32_t iNumSamples);
+
+		/** Decodes all audio assets of the parsed frame
+		*
+		* @sa IABParserInterface
+		*
+		*/
+		iabError DecodeAllAudioAssets(int32_t* const* oAudioSamples, uint32_t iNumAssets, uint32_t iNumSamples);
+
         /** Gets a string reference for the specified IAB error code.
          *
          * @sa IABParserInterface
@@ -153,9 +210,15 @@ namespace ImmersiveAudioBitstream
 
     private:
         
-        // GetAudioAsset assoicated with the given audio data ID.
-        // The function calls DLC decoder to decode the channel into audioSample.
-        iabError GetAudioAssetFromDLC(IABAudioDataIDType iAudioDataID, uint32_t iNumSamples, int32_t *oAudioSamples);
+        // Replaces the parsed frame with iNewFrame and parses it. iNewFrame may be the recycled parsed frame.
+        // iFrameBufferKept if iNewFrame parses from a buffer that stays valid after the parse call.
+        iabError DeSerializeFrame(IABFrameInterface* iNewFrame, bool iFrameBufferKept);
+        
+        // Record parsedFrameSize_ of the frame just parsed from memory
+        void UpdateParsedFrameSize();
+        
+        // Parsed frame to be parsed again in place, nullptr if frame recycling does not apply
+        IABFrame* GetRecyclableFrame();
         
         // Pointer to the IAB frame
         IABFrameInterface*          iabParserFrame_;
@@ -163,9 +226,37 @@ namespace ImmersiveAudioBitstream
         // Pointer to input stream that contains the IA bitstream to be parsed
         std::istream*               iabStream_;
         
+        // In-memory IA bitstream to be parsed, used in place of iabStream_, and the
+        // offset of the next frame in it
+        const char*                 iabBuffer_;
+        uint64_t                    iabBufferSize_;
+        uint64_t                    iabBufferOffset_;
+        
+        // Bytes taken up by the last frame parsed from memory, see GetParsedFrameSize()
+        uint64_t                    parsedFrameSize_;
+        
 		// Number of times unknown element IDs are found in parsing.
 		// Cumulative over frames for the lifetime of IABParser instance.
 		uint32_t unAllowedFrameSubElementsCount_;
+		
+		// Frame recycling enabled, see SetFrameRecycling(). Only frames parsed without errors are recycled.
+		bool frameRecycling_;
+		bool parsedFrameRecyclable_;
+		
+		// Allocation of parsed frame elements, see IABParserInterface::Create()
+		IABFrameAllocatorType frameAllocator_;
+		
+		// Lazy parsing of audio data elements enabled, see SetLazyAudioDataParsing()
+		bool lazyAudioDataParsing_;
+
+		// Frame header only parsing enabled, see SetFrameHeaderOnlyParsing()
+		bool frameHeaderOnlyParsing_;
+
+		// Preamble payload handling, see SetPreamblePayloadParsing()
+		IABPreamblePayloadParsingType preamblePayloadParsing_;
+
+		// DLC codec engines and buffers, shared by the DLC elements decoded by DecodeAudioAsset() and DecodeAllAudioAssets()
+		IABDLCCodecContext dlcCodecContext_;
 	};
 
 } // namespace ImmersiveAudioBitstream
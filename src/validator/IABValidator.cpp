@@ -956,6 +956,40 @@ namespace ImmersiveAudioBitstream
 		}
 	}
 
+	// IABValidator::ValidateIABFrameHeader() implementation
+	iabError IABValidator::ValidateIABFrameHeader(const IABFrameInterface *iIABFrame, uint32_t iFrameIndex)
+	{
+		if (iIABFrame == NULL)
+		{
+			return kIABBadArgumentsError;
+		}
+
+		frameUnderValidation_ = dynamic_cast<const IABFrame*>(iIABFrame);
+
+		if (frameUnderValidation_ == NULL)
+		{
+			return kIABBadArgumentsError;
+		}
+
+		// Update issue carrier variable
+		validationIssue_.reset();
+		validationIssue_.frameIndex_ = iFrameIndex;
+
+		// The first frame sets the global values, later frames are checked against them
+		if (isFirstFrame_)
+		{
+			isFirstFrame_ = false;
+		}
+		else if (ValidateFrameParametersPersistence() == false)
+		{
+			return kIABValidatorTerminationError;
+		}
+
+		SaveFrameHeaderToGlobal();
+
+		return kIABNoError;
+	}
+
 	// IABValidator::CollectAndCheckBedDefinitionStats() implementation
 	bool IABValidator::CollectAndCheckBedDefinitionStats(const IABBedDefinition *iBedDefinition)
 	{
@@ -2014,20 +2048,7 @@ namespace ImmersiveAudioBitstream
 	// IABValidator::SaveFrameParameterToGlobal() implementation
 	void IABValidator::SaveFrameParameterToGlobal()
 	{
-		// Global bitstream version for persistence checking
-		frameUnderValidation_->GetVersion(globalVersion_);
-
-		// Global sampling rate for persistence checking
-		frameUnderValidation_->GetSampleRate(globalSampleRate_);
-
-		// Global bit depth for persistence checking
-		frameUnderValidation_->GetBitDepth(globalBitDepth_);
-
-		// Global frame rate for persistence checking
-		frameUnderValidation_->GetFrameRate(globalFrameRate_);
-
-		// Global maximum rendered for persistence checking
-		frameUnderValidation_->GetMaxRendered(globalMaxRendered_);
+		SaveFrameHeaderToGlobal();
 
 		// Global frame sub-element count for persistence checking
 		frameUnderValidation_->GetSubElementCount(globalFrameSubElementCount_);
@@ -2052,6 +2073,25 @@ namespace ImmersiveAudioBitstream
 
 	}
 
+	// IABValidator::SaveFrameHeaderToGlobal() implementation
+	void IABValidator::SaveFrameHeaderToGlobal()
+	{
+		// Global bitstream version for persistence checking
+		frameUnderValidation_->GetVersion(globalVersion_);
+
+		// Global sampling rate for persistence checking
+		frameUnderValidation_->GetSampleRate(globalSampleRate_);
+
+		// Global bit depth for persistence checking
+		frameUnderValidation_->GetBitDepth(globalBitDepth_);
+
+		// Global frame rate for persistence checking
+		frameUnderValidation_->GetFrameRate(globalFrameRate_);
+
+		// Global maximum rendered for persistence checking
+		frameUnderValidation_->GetMaxRendered(globalMaxRendered_);
+	}
+
 	// IABValidator::ValidateEssenceElementsPresence() implementation
 	bool IABValidator::ValidateEssenceElementsPresence()
 	{
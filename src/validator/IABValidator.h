@@ -173,6 +173,13 @@ namespace ImmersiveAudioBitstream
          */
         iabError ValidateIABFrame(const IABFrameInterface *iIABFrame, uint32_t iFrameIndex);
         
+        /** Validate the frame header of an IAB frame only.
+         *
+         * @sa IABValidatorInterface
+         *
+         */
+        iabError ValidateIABFrameHeader(const IABFrameInterface *iIABFrame, uint32_t iFrameIndex);
+        
         /** Gets validation result for CS iConstraintSet.
          *
          * @sa IABValidatorInterface
@@ -376,6 +383,9 @@ namespace ImmersiveAudioBitstream
 		// Save program/frame parameter values as global, for persistence validation
 		void SaveFrameParameterToGlobal();
 
+		// Save frame header parameter values as global, for persistence validation
+		void SaveFrameHeaderToGlobal();
+
 		// Validate presence of referred-to essence elements
 		bool ValidateEssenceElementsPresence();
 
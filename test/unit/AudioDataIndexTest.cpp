@@ -0,0 +1,216 @@
+/* Copyright (c) 2020 Xperi Corporation (and its subsidiaries). All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining
+a copy of this software and associated documentation files (the "Software"),
+to deal in the Software without restriction, including without limitation
+the rights to use, copy, modify, merge, publish, distribute, sublicense,
+and/or sell copies of the Software, and to permit persons to whom the
+Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included
+in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+
+IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT
+OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR
+THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+
+// Unit test of the look-up of audio assets in a parsed frame after their AudioDataIDs are changed.
+//
+// A frame of two AudioDataDLC elements and one AudioDataPCM element is parsed, and the assets are decoded
+// by AudioDataID. The AudioDataIDs of one DLC element and of the PCM element are then set on the parsed
+// elements. GetAudioDataIDs(), DecodeAudioAsset() and DecodeAllAudioAssets() must follow the new IDs:
+// each asset decodes to the same samples under its new ID, and the old ID of a renamed asset is not found.
+
+#include <stdint.h>
+#include <cstdio>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "IABElements.h"
+#include "IABParserAPI.h"
+#include "IABUtilities.h"
+
+using namespace SMPTE::ImmersiveAudioBitstream;
+
+namespace
+{
+    const uint32_t kAssetCount = 3;
+
+    uint32_t randomState = 11223;
+
+    uint32_t Random()
+    {
+        randomState = randomState * 1103515245u + 12345u;
+
+        return randomState >> 8;
+    }
+
+    // Pack a 24 fps, 48 kHz frame of DLC assets with AudioDataIDs 1 and 2, and a 24-bit PCM asset with AudioDataID 3
+    bool MakeFrame(std::string &oData)
+    {
+        IABFrameInterface *frame = IABFrameInterface::Create(nullptr);
+        uint32_t sampleCount = GetIABNumFrameSamples(kIABFrameRate_24FPS, kIABSampleRate_48000Hz);
+        std::vector<int32_t> samples(sampleCount);
+        std::vector<IABElement*> subElements;
+        bool encoded = true;
+
+        frame->SetSampleRate(kIABSampleRate_48000Hz);
+        frame->SetFrameRate(kIABFrameRate_24FPS);
+        frame->SetMaxRendered(kAssetCount);
+
+        for (uint32_t i = 0; i < kAssetCount; i++)
+        {
+            for (uint32_t n = 0; n < sampleCount; n++)
+            {
+                samples[n] = static_cast<int32_t>(Random() % 65536 - 32768) << 8;
+            }
+
+            if (i < kAssetCount - 1)
+            {
+                IABAudioDataDLCInterface *audioData = IABAudioDataDLCInterface::Create(kIABFrameRate_24FPS, kIABSampleRate_48000Hz);
+
+                audioData->SetAudioDataID(i + 1);
+                encoded = (kIABNoError == audioData->EncodeMonoPCMToDLC(&samples[0], sampleCount)) && encoded;
+                subElements.push_back(dynamic_cast<IABElement*>(audioData));
+            }
+            else
+            {
+                IABAudioDataPCMInterface *audioData = IABAudioDataPCMInterface::Create(kIABFrameRate_24FPS, kIABSampleRate_48000Hz, kIABBitDepth_24Bit);
+
+                audioData->SetAudioDataID(i + 1);
+                encoded = (kIABNoError == audioData->PackMonoSamplesToPCM(&samples[0], sampleCount)) && encoded;
+                subElements.push_back(dynamic_cast<IABElement*>(audioData));
+            }
+        }
+
+        frame->SetSubElements(subElements);
+
+        std::stringstream frameStream(std::stringstream::in | std::stringstream::out | std::stringstream::binary);
+        bool packed = (kIABNoError == frame->Serialize(frameStream));
+
+        oData = frameStream.str();
+        IABFrameInterface::Delete(frame);
+
+        return encoded && packed;
+    }
+
+    // Check that the assets of the parsed frame have iAudioDataIDs, in frame order, and decode to iSamples
+    bool CheckAssets(IABParserInterface *iParser, const IABAudioDataIDType iAudioDataIDs[kAssetCount],
+        const std::vector<int32_t> iSamples[kAssetCount], const char *iStep)
+    {
+        uint32_t sampleCount = static_cast<uint32_t>(iSamples[0].size());
+        std::vector<IABAudioDataIDType> audioDataIDs;
+        std::vector<int32_t> samples[kAssetCount];
+        int32_t *buffers[kAssetCount];
+        bool passed = true;
+
+        if ((kIABNoError != iParser->GetAudioDataIDs(audioDataIDs)) || (audioDataIDs.size() != kAssetCount))
+        {
+            printf("%s: %u AudioDataIDs, expected %u\n", iStep, static_cast<uint32_t>(audioDataIDs.size()), kAssetCount);
+
+            return false;
+        }
+
+        for (uint32_t i = 0; i < kAssetCount; i++)
+        {
+            samples[i].assign(sampleCount, 0);
+            buffers[i] = &samples[i][0];
+
+            if (audioDataIDs[i] != iAudioDataIDs[i])
+            {
+                printf("%s: asset %u has AudioDataID %u, expected %u\n", iStep, i, audioDataIDs[i], iAudioDataIDs[i]);
+                passed = false;
+            }
+
+            if ((kIABNoError != iParser->DecodeAudioAsset(iAudioDataIDs[i], &samples[i][0], sampleCount)) || (samples[i] != iSamples[i]))
+            {
+                printf("%s: asset with AudioDataID %u does not decode to the samples of asset %u\n", iStep, iAudioDataIDs[i], i);
+                passed = false;
+            }
+        }
+
+        if ((kIABNoError != iParser->DecodeAllAudioAssets(buffers, kAssetCount, sampleCount)) ||
+            (samples[0] != iSamples[0]) || (samples[1] != iSamples[1]) || (samples[2] != iSamples[2]))
+        {
+            printf("%s: assets decoded in one call are not the assets decoded by AudioDataID\n", iStep);
+            passed = false;
+        }
+
+        return passed;
+    }
+}
+
+int main()
+{
+    std::string data;
+    bool passed = MakeFrame(data);
+
+    if (!passed)
+    {
+        printf("Frame cannot be made\n");
+        printf("Failed\n");
+
+        return 1;
+    }
+
+    IABParserInterface *parser = IABParserInterface::Create(data.data(), data.size());
+    const IABFrameInterface *frameInterface = nullptr;
+    uint32_t sampleCount = GetIABNumFrameSamples(kIABFrameRate_24FPS, kIABSampleRate_48000Hz);
+    std::vector<int32_t> samples[kAssetCount];
+
+    if ((kIABNoError != parser->ParseIABFrame()) || (kIABNoError != parser->GetIABFrame(frameInterface)))
+    {
+        printf("Frame cannot be parsed\n");
+        passed = false;
+    }
+
+    for (uint32_t i = 0; passed && (i < kAssetCount); i++)
+    {
+        samples[i].assign(sampleCount, 0);
+
+        if (kIABNoError != parser->DecodeAudioAsset(i + 1, &samples[i][0], sampleCount))
+        {
+            printf("Asset with AudioDataID %u cannot be decoded\n", i + 1);
+            passed = false;
+        }
+    }
+
+    const IABAudioDataIDType parsedAudioDataIDs[kAssetCount] = { 1, 2, 3 };
+
+    passed = passed && CheckAssets(parser, parsedAudioDataIDs, samples, "Parsed frame");
+
+    if (passed)
+    {
+        std::vector<IABElement*> subElements;
+
+        frameInterface->GetSubElements(subElements);
+
+        // First DLC asset to AudioDataID 5, PCM asset to AudioDataID 1
+        dynamic_cast<IABAudioDataDLC*>(subElements[0])->SetAudioDataID(5);
+        dynamic_cast<IABAudioDataPCM*>(subElements[2])->SetAudioDataID(1);
+
+        const IABAudioDataIDType changedAudioDataIDs[kAssetCount] = { 5, 2, 1 };
+
+        passed = CheckAssets(parser, changedAudioDataIDs, samples, "Changed AudioDataIDs");
+
+        if (kIABNoSuchParameterError != parser->DecodeAudioAsset(3, &samples[0][0], sampleCount))
+        {
+            printf("Asset is found under its former AudioDataID\n");
+            passed = false;
+        }
+    }
+
+    IABParserInterface::Delete(parser);
+
+    printf("%s\n", passed ? "Passed" : "Failed");
+
+    return passed ? 0 : 1;
+}
@@ -0,0 +1,264 @@
+/* Copyright (c) 2020 Xperi Corporation (and its subsidiaries). All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining
+a copy of this software and associated documentation files (the "Software"),
+to deal in the Software without restriction, including without limitation
+the rights to use, copy, modify, merge, publish, distribute, sublicense,
+and/or sell copies of the Software, and to permit persons to whom the
+Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included
+in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+
+IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT
+OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR
+THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+// Unit test of the predictor coefficient cache of dlc::FullDecoder.
+//
+// Audio data of one prediction region is decoded twice with the same decoder: the second decoding must
+// be a cache hit, and output the same samples. Regions of the same lattice coefficients in other audio data
+// hit too. Regions that differ in their order or lattice coefficients must miss, including regions that map
+// to the same cache entry. Such pairs are found by decoding A, B, then A again: A misses again when B
+// replaced it. Every decoding must output the samples of a decoder with an empty cache.
+
+#include <stdint.h>
+#include <cstdio>
+#include <vector>
+
+#include "DLCAudioData.h"
+#include "DLCFullDecoder.h"
+
+namespace
+{
+    // 24 fps, 48 kHz: 10 sub-blocks of 200 samples, all in one prediction region
+    const uint8_t kSubBlockCount = 10;
+    const uint32_t kSubBlockLength = 200;
+    const uint32_t kMaxOrder = 31;
+
+    // Pairs of regions tried before giving up on finding two that map to the same cache entry
+    const uint32_t kMaxPairCount = 10000;
+
+    uint32_t randomState = 97531;
+
+    uint32_t Random()
+    {
+        randomState = randomState * 1103515245u + 12345u;
+
+        return randomState >> 8;
+    }
+
+    // Prediction region: order and lattice coefficients, the first one unused
+    struct Region
+    {
+        dlc::uint5_t order_;
+        dlc::uint10_t kCoeff_[32];
+    };
+
+    // Region of iOrder random lattice coefficients. Reflection coefficients are kept within [-0.125, 0.125],
+    // so that direct form coefficients and samples stay within range.
+    Region RandomRegion(dlc::uint5_t iOrder)
+    {
+        Region region;
+
+        region.order_ = iOrder;
+        region.kCoeff_[0] = 0;
+
+        for (uint32_t k = 1; k < 32; k++)
+        {
+            region.kCoeff_[k] = static_cast<dlc::uint10_t>(448 + Random() % 129);
+        }
+
+        return region;
+    }
+
+    // Set up oData with iRegion and residuals that depend on iRegion only
+    void MakeAudioData(const Region &iRegion, dlc::AudioData &oData)
+    {
+        uint32_t residualState = iRegion.order_;
+
+        for (uint32_t k = 1; k <= iRegion.order_; k++)
+        {
+            residualState = residualState * 31u + iRegion.kCoeff_[k];
+        }
+
+        oData.setSampleRate(dlc::eSampleRate_48000);
+        oData.setShiftBits(0);
+        oData.setNumDLCSubBlocks(kSubBlockCount);
+        oData.setNumPredRegions48(1);
+        oData.getPredRegion48(0).setRegionLength(kSubBlockCount);
+        oData.getPredRegion48(0).setOrder(iRegion.order_);
+        oData.getPredRegion48(0).setKCoeff(iRegion.kCoeff_);
+
+        for (uint8_t i = 0; i < kSubBlockCount; i++)
+        {
+            oData.initDLCSubBlock48(i, dlc::eCodeType_PCM_CODE_TYPE, kSubBlockLength);
+
+            dlc::PCMResidualsSubBlock *subBlock = static_cast<dlc::PCMResidualsSubBlock*>(oData.getDLCSubBlock48(i));
+            int32_t *residuals = subBlock->getResiduals();
+
+            subBlock->setBitDepth(13);
+
+            for (uint32_t n = 0; n < kSubBlockLength; n++)
+            {
+                residualState = residualState * 1103515245u + 12345u;
+                residuals[n] = static_cast<int32_t>((residualState >> 8) % 8192) - 4096;
+            }
+        }
+    }
+
+    // Decode iRegion with ioDecoder into oSamples. The samples must match those of a new decoder.
+    bool Decode(dlc::FullDecoder &ioDecoder, const Region &iRegion, std::vector<int32_t> &oSamples)
+    {
+        dlc::AudioData data;
+        dlc::FullDecoder newDecoder;
+        std::vector<int32_t> expectedSamples(kSubBlockCount * kSubBlockLength);
+
+        MakeAudioData(iRegion, data);
+        oSamples.assign(kSubBlockCount * kSubBlockLength, 0);
+
+        if ((ioDecoder.decode_noexcept(&oSamples[0], static_cast<uint32_t>(oSamples.size()), dlc::eSampleRate_48000, data) != dlc::FullDecoder::StatusCode_OK) ||
+            (newDecoder.decode_noexcept(&expectedSamples[0], static_cast<uint32_t>(expectedSamples.size()), dlc::eSampleRate_48000, data) != dlc::FullDecoder::StatusCode_OK))
+        {
+            printf("Order %u region cannot be decoded\n", iRegion.order_);
+            return false;
+        }
+
+        if (oSamples != expectedSamples)
+        {
+            printf("Order %u region decodes to other samples than with an empty cache\n", iRegion.order_);
+            return false;
+        }
+
+        return true;
+    }
+
+    // Check the hit and miss counts of iDecoder
+    bool CheckCounts(const dlc::FullDecoder &iDecoder, uint64_t iHits, uint64_t iMisses, const char *iStep)
+    {
+        if ((iDecoder.getCoeffCacheHits() != iHits) || (iDecoder.getCoeffCacheMisses() != iMisses))
+        {
+            printf("%s: %u hits and %u misses, expected %u and %u\n", iStep,
+                static_cast<uint32_t>(iDecoder.getCoeffCacheHits()), static_cast<uint32_t>(iDecoder.getCoeffCacheMisses()),
+                static_cast<uint32_t>(iHits), static_cast<uint32_t>(iMisses));
+            return false;
+        }
+
+        return true;
+    }
+
+    // Decode each order twice, then again from other audio data of the same region
+    bool CheckHits()
+    {
+        dlc::FullDecoder decoder;
+        bool passed = true;
+
+        for (dlc::uint5_t order = 1; passed && (order <= kMaxOrder); order++)
+        {
+            Region region = RandomRegion(order);
+            std::vector<int32_t> firstSamples;
+            std::vector<int32_t> samples;
+
+            decoder.resetCoeffCacheCounters();
+
+            passed = Decode(decoder, region, firstSamples) && CheckCounts(decoder, 0, 1, "First decoding");
+            passed = passed && Decode(decoder, region, samples) && CheckCounts(decoder, 1, 1, "Second decoding");
+
+            if (passed && (samples != firstSamples))
+            {
+                printf("Order %u region decodes to other samples on a cache hit\n", order);
+                passed = false;
+            }
+
+            // Coefficients above the order are not used
+            for (uint32_t k = order + 1; k < 32; k++)
+            {
+                region.kCoeff_[k] = static_cast<dlc::uint10_t>(Random() % 1024);
+            }
+
+            passed = passed && Decode(decoder, region, samples) && CheckCounts(decoder, 2, 1, "Other audio data of the same region");
+        }
+
+        return passed;
+    }
+
+    // Decode region A, a different region B, then A again, with a new decoder. Returns true in oShared when
+    // A missed again, B having replaced it in the cache.
+    bool CheckPair(const Region &iRegionA, const Region &iRegionB, bool &oShared)
+    {
+        dlc::FullDecoder decoder;
+        std::vector<int32_t> samples;
+
+        bool passed = Decode(decoder, iRegionA, samples) && Decode(decoder, iRegionB, samples) && CheckCounts(decoder, 0, 2, "Different regions");
+
+        passed = passed && Decode(decoder, iRegionA, samples);
+        oShared = (decoder.getCoeffCacheMisses() == 3);
+
+        return passed;
+    }
+
+    // Find regions of the same order and different coefficients, then regions of the same coefficients and
+    // different orders, that map to the same cache entry
+    bool CheckCollisions()
+    {
+        bool passed = true;
+        bool shared = false;
+        uint32_t pairCount = 0;
+
+        for (pairCount = 0; passed && !shared && (pairCount < kMaxPairCount); pairCount++)
+        {
+            dlc::uint5_t order = static_cast<dlc::uint5_t>(1 + Random() % kMaxOrder);
+            Region regionA = RandomRegion(order);
+            Region regionB = regionA;
+
+            dlc::uint10_t &kCoeff = regionB.kCoeff_[1 + Random() % order];
+
+            kCoeff = static_cast<dlc::uint10_t>(448 + (kCoeff - 448 + 1 + Random() % 128) % 129);
+
+            passed = CheckPair(regionA, regionB, shared);
+        }
+
+        if (passed && !shared)
+        {
+            printf("No regions of different coefficients found in the same cache entry\n");
+            passed = false;
+        }
+
+        shared = false;
+
+        for (pairCount = 0; passed && !shared && (pairCount < kMaxPairCount); pairCount++)
+        {
+            Region regionA = RandomRegion(kMaxOrder);
+            Region regionB = regionA;
+
+            regionB.order_ = static_cast<dlc::uint5_t>(1 + Random() % (kMaxOrder - 1));
+
+            passed = CheckPair(regionA, regionB, shared);
+        }
+
+        if (passed && !shared)
+        {
+            printf("No regions of different orders found in the same cache entry\n");
+            passed = false;
+        }
+
+        return passed;
+    }
+}
+
+int main()
+{
+    bool passed = CheckHits();
+
+    passed = passed && CheckCollisions();
+
+    printf("%s\n", passed ? "Passed" : "Failed");
+
+    return passed ? 0 : 1;
+}
@@ -0,0 +1,213 @@
+/* Copyright (c) 2020 Xperi Corporation (and its subsidiaries). All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining
+a copy of this software and associated documentation files (the "Software"),
+to deal in the Software without restriction, including without limitation
+the rights to use, copy, modify, merge, publish, distribute, sublicense,
+and/or sell copies of the Software, and to permit persons to whom the
+Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included
+in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+
+IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT
+OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR
+THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+// Unit test of the inverse prediction kernels of dlc::FullDecoder.
+//
+// DLC audio data of random residuals and random lattice coefficients is decoded with each instruction set
+// supported by the build and the CPU, and must match the scalar kernels exactly. The first prediction
+// region runs each order from 1 to 31, the others random orders. 48 kHz data is decoded at 48 kHz, 96 kHz
+// data at 96 kHz, where the 48 kHz layer is filtered every second sample, and at 48 kHz.
+
+#include <stdint.h>
+#include <cstdio>
+#include <vector>
+
+#include "DLCAudioData.h"
+#include "DLCFullDecoder.h"
+
+namespace
+{
+    // 24 fps: 10 sub-blocks of 200 samples at 48 kHz, of 100 and 200 samples in the 48 and 96 kHz layers at 96 kHz
+    const uint8_t kSubBlockCount = 10;
+    const uint32_t kSampleCount48 = 2000;
+    const uint32_t kMaxOrder = 31;
+
+    // Sub-blocks of the prediction regions, which cover all sub-blocks
+    const dlc::uint2_t kRegionCount = 3;
+    const dlc::uint4_t kRegionLengths[kRegionCount] = { 3, 3, 4 };
+
+    uint32_t randomState = 13579;
+
+    uint32_t Random()
+    {
+        randomState = randomState * 1103515245u + 12345u;
+
+        return randomState >> 8;
+    }
+
+    // Set up iRegion with iOrder random lattice coefficients. Reflection coefficients are kept within
+    // [-0.125, 0.125], so that direct form coefficients and samples stay within range.
+    void SetRegion(dlc::PredRegion &iRegion, dlc::uint4_t iLength, dlc::uint5_t iOrder)
+    {
+        dlc::uint10_t kCoeff[32] = { 0 };
+
+        for (uint32_t k = 1; k <= iOrder; k++)
+        {
+            kCoeff[k] = static_cast<dlc::uint10_t>(448 + Random() % 129);
+        }
+
+        iRegion.setRegionLength(iLength);
+        iRegion.setOrder(iOrder);
+        iRegion.setKCoeff(kCoeff);
+    }
+
+    // Fill iSubBlock with random residuals
+    void SetResiduals(dlc::ResidualSubBlock *iSubBlock)
+    {
+        int32_t *residuals = static_cast<dlc::PCMResidualsSubBlock*>(iSubBlock)->getResiduals();
+
+        static_cast<dlc::PCMResidualsSubBlock*>(iSubBlock)->setBitDepth(13);
+
+        for (uint32_t n = 0; n < iSubBlock->getSize(); n++)
+        {
+            residuals[n] = static_cast<int32_t>(Random() % 8192) - 4096;
+        }
+    }
+
+    // Set up oData with random residuals, the first region of each layer of order iOrder
+    void MakeAudioData(dlc::SampleRate iSampleRate, dlc::uint5_t iOrder, dlc::AudioData &oData)
+    {
+        uint32_t subBlockSize48 = kSampleCount48 / kSubBlockCount;
+
+        oData.setSampleRate(iSampleRate);
+        oData.setShiftBits(0);
+        oData.setNumDLCSubBlocks(kSubBlockCount);
+        oData.setNumPredRegions48(kRegionCount);
+
+        for (dlc::uint2_t i = 0; i < kRegionCount; i++)
+        {
+            SetRegion(oData.getPredRegion48(i), kRegionLengths[i], (i == 0) ? iOrder : static_cast<dlc::uint5_t>(1 + Random() % kMaxOrder));
+        }
+
+        if (iSampleRate == dlc::eSampleRate_96000)
+        {
+            subBlockSize48 /= 2;
+
+            // The 96 kHz layer runs the coefficients of the 48 kHz region of the same index, up to its own order
+            oData.setNumPredRegions96(kRegionCount);
+
+            for (dlc::uint2_t i = 0; i < kRegionCount; i++)
+            {
+                oData.getPredRegion96(i).setRegionLength(kRegionLengths[i]);
+                oData.getPredRegion96(i).setOrder((i == 0) ? iOrder : static_cast<dlc::uint5_t>(1 + Random() % kMaxOrder));
+            }
+        }
+
+        for (uint8_t i = 0; i < kSubBlockCount; i++)
+        {
+            oData.initDLCSubBlock48(i, dlc::eCodeType_PCM_CODE_TYPE, subBlockSize48);
+            SetResiduals(oData.getDLCSubBlock48(i));
+
+            if (iSampleRate == dlc::eSampleRate_96000)
+            {
+                oData.initDLCSubBlock96(i, dlc::eCodeType_PCM_CODE_TYPE, subBlockSize48 * 2);
+                SetResiduals(oData.getDLCSubBlock96(i));
+            }
+        }
+    }
+
+    // Decode iData at iSampleRate with the kernels of iInstructionSet
+    bool Decode(const dlc::AudioData &iData, dlc::SampleRate iSampleRate, dlc::FullDecoder::InstructionSet iInstructionSet, std::vector<int32_t> &oSamples)
+    {
+        dlc::FullDecoder decoder;
+
+        oSamples.assign((iSampleRate == dlc::eSampleRate_96000) ? iData.getSampleCount96() : iData.getSampleCount48(), 0);
+
+        return decoder.setInstructionSet(iInstructionSet)
+            && (decoder.decode_noexcept(&oSamples[0], static_cast<uint32_t>(oSamples.size()), iSampleRate, iData) == dlc::FullDecoder::StatusCode_OK);
+    }
+}
+
+int main()
+{
+    const dlc::FullDecoder::InstructionSet kInstructionSets[] =
+    {
+        dlc::FullDecoder::InstructionSet_Auto,
+        dlc::FullDecoder::InstructionSet_SSE41,
+        dlc::FullDecoder::InstructionSet_AVX2
+    };
+    const char *kInstructionSetNames[] = { "Auto", "SSE4.1", "AVX2" };
+    const uint32_t kInstructionSetCount = sizeof(kInstructionSets) / sizeof(kInstructionSets[0]);
+
+    bool passed = true;
+
+    for (uint32_t s = 0; s < kInstructionSetCount; s++)
+    {
+        dlc::FullDecoder decoder;
+
+        if (!decoder.setInstructionSet(kInstructionSets[s]))
+        {
+            printf("%s kernels are not supported, skipped\n", kInstructionSetNames[s]);
+        }
+    }
+
+    for (uint32_t rate = 0; rate < 2; rate++)
+    {
+        dlc::SampleRate dataSampleRate = (rate == 0) ? dlc::eSampleRate_48000 : dlc::eSampleRate_96000;
+
+        for (dlc::uint5_t order = 1; order <= kMaxOrder; order++)
+        {
+            dlc::AudioData data;
+
+            MakeAudioData(dataSampleRate, order, data);
+
+            // 96 kHz data is also decoded to 48 kHz, from its 48 kHz layer
+            for (uint32_t output = 0; output <= rate; output++)
+            {
+                dlc::SampleRate outputSampleRate = (output == 0) ? dlc::eSampleRate_48000 : dlc::eSampleRate_96000;
+                std::vector<int32_t> expectedSamples;
+                std::vector<int32_t> samples;
+
+                if (!Decode(data, outputSampleRate, dlc::FullDecoder::InstructionSet_Scalar, expectedSamples))
+                {
+                    printf("Order %u, %s kHz data cannot be decoded\n", order, (rate == 0) ? "48" : "96");
+                    passed = false;
+                    continue;
+                }
+
+                for (uint32_t s = 0; s < kInstructionSetCount; s++)
+                {
+                    if (!Decode(data, outputSampleRate, kInstructionSets[s], samples))
+                    {
+                        continue;
+                    }
+
+                    for (uint32_t n = 0; n < samples.size(); n++)
+                    {
+                        if (samples[n] != expectedSamples[n])
+                        {
+                            printf("Order %u, %s kHz data decoded at %s kHz: %s kernel outputs %d at sample %u, scalar kernel %d\n",
+                                order, (rate == 0) ? "48" : "96", (output == 0) ? "48" : "96", kInstructionSetNames[s],
+                                samples[n], n, expectedSamples[n]);
+                            passed = false;
+                            break;
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    printf("%s\n", passed ? "Passed" : "Failed");
+
+    return passed ? 0 : 1;
+}
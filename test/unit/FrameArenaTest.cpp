@@ -0,0 +1,214 @@
+/* Copyright (c) 2020 Xperi Corporation (and its subsidiaries). All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining
+a copy of this software and associated documentation files (the "Software"),
+to deal in the Software without restriction, including without limitation
+the rights to use, copy, modify, merge, publish, distribute, sublicense,
+and/or sell copies of the Software, and to permit persons to whom the
+Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included
+in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+
+IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT
+OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR
+THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+// Unit test of the ownership of sub-elements removed from parsed frames, with both frame allocators.
+//
+// Two frames are parsed with frame recycling, so that the second frame is parsed into the first one.
+// With kIABFrameAllocator_Heap, a sub-element removed from the first frame belongs to the caller: it must
+// still pack to the same bytes once the frame is recycled. With kIABFrameAllocator_Arena, sub-elements of
+// a parsed frame are released with it, so RemoveSubElement() and ClearSubElements() must refuse to hand
+// them over and leave the frame as is. A sub-element added by the caller can still be removed.
+
+#include <stdint.h>
+#include <cstdio>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "IABElements.h"
+#include "IABParserAPI.h"
+
+using namespace SMPTE::ImmersiveAudioBitstream;
+
+namespace
+{
+    const uint32_t kObjectCount = 8;
+
+    // Pack a 24 fps, 48 kHz frame of kObjectCount objects, with positions depending on iFrameIndex
+    bool MakeFrame(uint32_t iFrameIndex, std::string &ioData)
+    {
+        IABFrameInterface *frame = IABFrameInterface::Create(nullptr);
+        std::vector<IABElement*> subElements;
+
+        frame->SetSampleRate(kIABSampleRate_48000Hz);
+        frame->SetFrameRate(kIABFrameRate_24FPS);
+        frame->SetMaxRendered(kObjectCount);
+
+        for (uint32_t i = 0; i < kObjectCount; i++)
+        {
+            IABObjectDefinition *object = dynamic_cast<IABObjectDefinition*>(IABObjectDefinitionInterface::Create(kIABFrameRate_24FPS));
+            std::vector<IABObjectSubBlock*> subBlocks;
+            uint8_t subBlockCount = 0;
+
+            object->SetMetadataID(i + 1);
+            object->SetAudioDataID(0);
+            object->GetNumPanSubBlocks(subBlockCount);
+
+            for (uint8_t n = 0; n < subBlockCount; n++)
+            {
+                IABObjectSubBlock *subBlock = dynamic_cast<IABObjectSubBlock*>(IABObjectSubBlockInterface::Create());
+                CartesianPosInUnitCube position;
+
+                position.setIABObjectPosition(0.1f * (iFrameIndex + 1), 0.01f * i, 0.1f * n);
+                subBlock->SetPanInfoExists(true);
+                subBlock->SetObjectPositionFromUnitCube(position);
+                subBlocks.push_back(subBlock);
+            }
+
+            object->SetPanSubBlocks(subBlocks);
+            subElements.push_back(object);
+        }
+
+        frame->SetSubElements(subElements);
+
+        std::stringstream frameStream(std::stringstream::in | std::stringstream::out | std::stringstream::binary);
+        bool packed = (kIABNoError == frame->Serialize(frameStream));
+
+        ioData += frameStream.str();
+        IABFrameInterface::Delete(frame);
+
+        return packed;
+    }
+
+    // Pack iElement on its own
+    std::string PackElement(IABElement *iElement)
+    {
+        std::stringstream elementStream(std::stringstream::in | std::stringstream::out | std::stringstream::binary);
+
+        iElement->Serialize(elementStream);
+
+        return elementStream.str();
+    }
+
+    // Remove a sub-element from the first parsed frame, then parse the second frame into the same frame
+    bool CheckRemove(const std::string &iData, IABFrameAllocatorType iFrameAllocator)
+    {
+        const char *allocatorName = (iFrameAllocator == kIABFrameAllocator_Arena) ? "arena" : "heap";
+        IABParserInterface *parser = IABParserInterface::Create(iData.data(), iData.size(), iFrameAllocator);
+        const IABFrameInterface *frameInterface = nullptr;
+        bool passed = true;
+
+        parser->SetFrameRecycling(true);
+
+        if ((kIABNoError != parser->ParseIABFrame()) || (kIABNoError != parser->GetIABFrame(frameInterface)))
+        {
+            printf("%s: first frame cannot be parsed\n", allocatorName);
+            IABParserInterface::Delete(parser);
+
+            return false;
+        }
+
+        IABFrameInterface *frame = const_cast<IABFrameInterface*>(frameInterface);
+        std::vector<IABElement*> subElements;
+
+        frame->GetSubElements(subElements);
+
+        IABElement *removedElement = subElements[1];
+        std::string packedElement = PackElement(removedElement);
+        iabError removeError = frame->RemoveSubElement(removedElement);
+        iabError clearError = frame->ClearSubElements();
+        IABElementCountType subElementCount = 0;
+
+        frame->GetSubElementCount(subElementCount);
+
+        if (iFrameAllocator == kIABFrameAllocator_Arena)
+        {
+            // The frame keeps all its parsed sub-elements
+            if ((removeError != kIABNotImplementedError) || (clearError != kIABNotImplementedError) ||
+                (subElementCount != kObjectCount) || !frame->IsSubElement(removedElement))
+            {
+                printf("%s: parsed sub-elements are handed over, errors %d and %d\n", allocatorName, removeError, clearError);
+                passed = false;
+            }
+
+            removedElement = nullptr;
+
+            // A heap allocated sub-element is handed back
+            IABElement *addedElement = dynamic_cast<IABElement*>(IABAuthoringToolInfoInterface::Create());
+
+            if ((kIABNoError != frame->AddSubElement(addedElement)) || (kIABNoError != frame->RemoveSubElement(addedElement)))
+            {
+                printf("%s: sub-element added by the caller cannot be removed\n", allocatorName);
+                passed = false;
+            }
+
+            delete addedElement;
+        }
+        else
+        {
+            // The removed sub-element now belongs to the caller, as do the others after ClearSubElements()
+            if ((removeError != kIABNoError) || (clearError != kIABNoError) || (subElementCount != 0))
+            {
+                printf("%s: sub-elements cannot be removed, errors %d and %d\n", allocatorName, removeError, clearError);
+                passed = false;
+            }
+
+            for (size_t i = 0; (clearError == kIABNoError) && (i < subElements.size()); i++)
+            {
+                if (subElements[i] != removedElement)
+                {
+                    delete subElements[i];
+                }
+            }
+        }
+
+        // Recycle the frame for the second frame
+        if ((kIABNoError != parser->ParseIABFrame()) || (kIABNoError != parser->GetIABFrame(frameInterface)))
+        {
+            printf("%s: second frame cannot be parsed\n", allocatorName);
+            passed = false;
+        }
+
+        if (removedElement)
+        {
+            if (PackElement(removedElement) != packedElement)
+            {
+                printf("%s: removed sub-element changes when the frame is recycled\n", allocatorName);
+                passed = false;
+            }
+
+            delete removedElement;
+        }
+
+        IABParserInterface::Delete(parser);
+
+        return passed;
+    }
+}
+
+int main()
+{
+    std::string data;
+    bool passed = MakeFrame(0, data) && MakeFrame(1, data);
+
+    if (!passed)
+    {
+        printf("Frames cannot be made\n");
+    }
+
+    passed = passed && CheckRemove(data, kIABFrameAllocator_Heap);
+    passed = passed && CheckRemove(data, kIABFrameAllocator_Arena);
+
+    printf("%s\n", passed ? "Passed" : "Failed");
+
+    return passed ? 0 : 1;
+}
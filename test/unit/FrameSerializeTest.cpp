@@ -0,0 +1,212 @@
+/* Copyright (c) 2020 Xperi Corporation (and its subsidiaries). All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining
+a copy of this software and associated documentation files (the "Software"),
+to deal in the Software without restriction, including without limitation
+the rights to use, copy, modify, merge, publish, distribute, sublicense,
+and/or sell copies of the Software, and to permit persons to whom the
+Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included
+in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+
+IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT
+OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR
+THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+// Unit test of IABFrame serialization of parsed frames.
+//
+// A frame of objects and their audio data, with a preamble, is packed, then parsed back. Parsed in full,
+// it packs to the same bytes. Parsed header only, it has no sub-elements to pack while its sub-element
+// count is kept, and packing must fail. Parsed with its preamble payload skipped, packing must fail too.
+// IABFrame::Serialize() must return the same, into a stream and into caller memory.
+
+#include <stdint.h>
+#include <cstdio>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "IABElements.h"
+#include "IABParserAPI.h"
+#include "IABUtilities.h"
+
+using namespace SMPTE::ImmersiveAudioBitstream;
+
+namespace
+{
+    const uint32_t kObjectCount = 4;
+    const uint32_t kPreambleLength = 100;
+
+    uint32_t randomState = 24680;
+
+    uint32_t Random()
+    {
+        randomState = randomState * 1103515245u + 12345u;
+
+        return randomState >> 8;
+    }
+
+    // Pack a 24 fps, 48 kHz frame of kObjectCount objects, each with its DLC coded audio, and a preamble
+    // payload of kPreambleLength bytes
+    bool MakeFrame(std::string &oData)
+    {
+        IABFrameInterface *frame = IABFrameInterface::Create(nullptr);
+        uint32_t sampleCount = GetIABNumFrameSamples(kIABFrameRate_24FPS, kIABSampleRate_48000Hz);
+        std::vector<int32_t> samples(sampleCount);
+        std::vector<IABElement*> subElements;
+        bool encoded = true;
+
+        frame->SetSampleRate(kIABSampleRate_48000Hz);
+        frame->SetFrameRate(kIABFrameRate_24FPS);
+        frame->SetMaxRendered(kObjectCount);
+
+        for (uint32_t i = 0; i < kObjectCount; i++)
+        {
+            IABObjectDefinition *object = dynamic_cast<IABObjectDefinition*>(IABObjectDefinitionInterface::Create(kIABFrameRate_24FPS));
+            std::vector<IABObjectSubBlock*> subBlocks;
+            uint8_t subBlockCount = 0;
+
+            object->SetMetadataID(i + 1);
+            object->SetAudioDataID(i + 1);
+            object->GetNumPanSubBlocks(subBlockCount);
+
+            for (uint8_t n = 0; n < subBlockCount; n++)
+            {
+                IABObjectSubBlock *subBlock = dynamic_cast<IABObjectSubBlock*>(IABObjectSubBlockInterface::Create());
+                CartesianPosInUnitCube position;
+
+                position.setIABObjectPosition((Random() % 1000) / 1000.0f, (Random() % 1000) / 1000.0f, (Random() % 1000) / 1000.0f);
+                subBlock->SetPanInfoExists(true);
+                subBlock->SetObjectPositionFromUnitCube(position);
+                subBlocks.push_back(subBlock);
+            }
+
+            object->SetPanSubBlocks(subBlocks);
+            subElements.push_back(object);
+
+            IABAudioDataDLCInterface *audioData = IABAudioDataDLCInterface::Create(kIABFrameRate_24FPS, kIABSampleRate_48000Hz);
+
+            for (uint32_t n = 0; n < sampleCount; n++)
+            {
+                samples[n] = static_cast<int32_t>(Random() % 65536 - 32768) << 8;
+            }
+
+            audioData->SetAudioDataID(i + 1);
+            encoded = (kIABNoError == audioData->EncodeMonoPCMToDLC(&samples[0], sampleCount)) && encoded;
+            subElements.push_back(dynamic_cast<IABElement*>(audioData));
+        }
+
+        frame->SetSubElements(subElements);
+
+        std::stringstream frameStream(std::stringstream::in | std::stringstream::out | std::stringstream::binary);
+        bool packed = (kIABNoError == frame->Serialize(frameStream));
+
+        // The frame made has an empty preamble subframe: 8-bit tag and 32-bit length
+        std::string frameData = frameStream.str();
+
+        oData = frameData.substr(0, 1);
+        oData += static_cast<char>(0);
+        oData += static_cast<char>(0);
+        oData += static_cast<char>(0);
+        oData += static_cast<char>(kPreambleLength);
+
+        for (uint32_t i = 0; i < kPreambleLength; i++)
+        {
+            oData += static_cast<char>(Random());
+        }
+
+        oData += frameData.substr(5);
+        IABFrameInterface::Delete(frame);
+
+        return encoded && packed;
+    }
+
+    // Parse iData, in full or header only, and pack the parsed frame into oData. Packing into caller memory
+    // must return the same.
+    iabError ParseAndPack(const std::string &iData, bool iHeaderOnly, IABPreamblePayloadParsingType iPreamblePayloadParsing, std::string &oData)
+    {
+        IABParserInterface *parser = IABParserInterface::Create(iData.data(), iData.size());
+        const IABFrameInterface *frameInterface = nullptr;
+
+        parser->SetFrameHeaderOnlyParsing(iHeaderOnly);
+        parser->SetPreamblePayloadParsing(iPreamblePayloadParsing);
+
+        iabError errorCode = parser->ParseIABFrame();
+
+        if (errorCode == kIABNoError)
+        {
+            errorCode = parser->GetIABFrame(frameInterface);
+        }
+
+        oData.clear();
+
+        if (errorCode == kIABNoError)
+        {
+            IABFrameInterface *frame = const_cast<IABFrameInterface*>(frameInterface);
+            std::stringstream frameStream(std::stringstream::in | std::stringstream::out | std::stringstream::binary);
+            std::vector<uint8_t> frameBuffer(iData.size());
+            uint32_t frameSize = 0;
+
+            errorCode = frame->Serialize(frameStream);
+            oData = frameStream.str();
+
+            iabError bufferErrorCode = frame->Serialize(&frameBuffer[0], static_cast<uint32_t>(frameBuffer.size()), frameSize);
+
+            if ((bufferErrorCode != errorCode) || (frameSize != oData.size()) ||
+                (oData.compare(0, oData.size(), reinterpret_cast<const char*>(&frameBuffer[0]), frameSize) != 0))
+            {
+                printf("Serialize() into caller memory returns %d, %u bytes, into a stream %d, %u bytes\n",
+                    bufferErrorCode, frameSize, errorCode, static_cast<uint32_t>(oData.size()));
+
+                errorCode = kIABGeneralError;
+            }
+        }
+
+        IABParserInterface::Delete(parser);
+
+        return errorCode;
+    }
+}
+
+int main()
+{
+    std::string frameData;
+    std::string packedData;
+    bool passed = true;
+
+    if (!MakeFrame(frameData))
+    {
+        printf("Frame cannot be made\n");
+        passed = false;
+    }
+
+    if (passed && ((kIABNoError != ParseAndPack(frameData, false, kIABPreamblePayload_Copy, packedData)) || (packedData != frameData)))
+    {
+        printf("Frame parsed in full does not pack to the same bytes\n");
+        passed = false;
+    }
+
+    // Nothing is output for a frame that fails to pack
+    if (passed && ((kIABNoError == ParseAndPack(frameData, true, kIABPreamblePayload_Copy, packedData)) || !packedData.empty()))
+    {
+        printf("Frame parsed header only packs with no sub-elements\n");
+        passed = false;
+    }
+
+    if (passed && ((kIABNoError == ParseAndPack(frameData, false, kIABPreamblePayload_Skip, packedData)) || !packedData.empty()))
+    {
+        printf("Frame parsed with its preamble payload skipped packs with no preamble payload\n");
+        passed = false;
+    }
+
+    printf("%s\n", passed ? "Passed" : "Failed");
+
+    return passed ? 0 : 1;
+}
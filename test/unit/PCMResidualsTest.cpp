@@ -0,0 +1,307 @@
+/* Copyright (c) 2020 Xperi Corporation (and its subsidiaries). All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining
+a copy of this software and associated documentation files (the "Software"),
+to deal in the Software without restriction, including without limitation
+the rights to use, copy, modify, merge, publish, distribute, sublicense,
+and/or sell copies of the Software, and to permit persons to whom the
+Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included
+in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+
+IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT
+OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR
+THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+// Unit test of the PCM residual unpacking of IABAudioDataDLC::DeSerialize(), which unpacks residuals from
+// the reader's word lookahead, against the field by field reads it replaced.
+//
+// DLC elements of PCM coded sub-blocks, bit depths 1 to 24 with some zero residuals, are parsed and decoded.
+// Without prediction and shift, the decoded samples are the residuals. They must match the encoded values
+// and a field by field reference parse. Sub-blocks start at every bit phase. Elements cut short must fail,
+// as the reference parse does, at the same stream position.
+
+#include <stdint.h>
+#include <cstdio>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "IABElements.h"
+#include "BitStreamIOHelpers.h"
+#include "RawIStream.h"
+
+using namespace SMPTE::ImmersiveAudioBitstream;
+using namespace CommonStream;
+
+namespace
+{
+    // 24 fps, 48 kHz DLC element: 10 sub-blocks of 200 samples
+    const uint32_t kSubBlockCount = 10;
+    const uint32_t kSubBlockLength = 200;
+    const uint32_t kSampleCount = kSubBlockCount * kSubBlockLength;
+
+    uint32_t randomState = 54321;
+
+    uint32_t Random()
+    {
+        randomState = randomState * 1103515245u + 12345u;
+
+        return randomState >> 8;
+    }
+
+    // Encoded DLC element, with the values of its residuals
+    struct DLCElement
+    {
+        std::string data_;
+        std::vector<int32_t> residuals_;
+    };
+
+    // Make an element of PCM coded sub-blocks, adding the bit phase of each sub-block's residuals to ioPhases
+    void MakeElement(DLCElement &oElement, std::vector<bool> &ioPhases)
+    {
+        std::stringstream payload(std::stringstream::in | std::stringstream::out | std::stringstream::binary);
+        BitStreamWriterT<std::ostream> payloadWriter(payload);
+
+        oElement.residuals_.clear();
+
+        // AudioDataID, DLCSize, SampleRate (48 kHz), ShiftBits, NumPredRegions48
+        write(payloadWriter, Plex<8>(1 + Random() % 200));
+        payloadWriter.write(static_cast<uint16_t>(0));
+        payloadWriter.write(static_cast<uint8_t>(0), 2);
+        payloadWriter.write(static_cast<uint8_t>(0), 5);
+        payloadWriter.write(static_cast<uint8_t>(0), 2);
+
+        for (uint32_t n = 0; n < kSubBlockCount; n++)
+        {
+            uint8_t bitDepth = static_cast<uint8_t>(1 + Random() % 24);
+            uint32_t zeroPercent = Random() % 50;
+
+            payloadWriter.write(static_cast<uint8_t>(dlc::eCodeType_PCM_CODE_TYPE), 1);
+            payloadWriter.write(bitDepth, 5);
+
+            // The element head is whole bytes, phases in the payload are phases in the element
+            ioPhases[payloadWriter.getBitCount() % 8] = true;
+
+            for (uint32_t i = 0; i < kSubBlockLength; i++)
+            {
+                uint32_t magnitude = Random() & ((1u << bitDepth) - 1);
+
+                if ((Random() % 100) < zeroPercent)
+                {
+                    magnitude = 0;
+                }
+
+                payloadWriter.write(magnitude, bitDepth);
+
+                if (magnitude == 0)
+                {
+                    oElement.residuals_.push_back(0);
+                }
+                else if (Random() & 1)
+                {
+                    payloadWriter.write(true);
+                    oElement.residuals_.push_back(-static_cast<int32_t>(magnitude));
+                }
+                else
+                {
+                    payloadWriter.write(false);
+                    oElement.residuals_.push_back(static_cast<int32_t>(magnitude));
+                }
+            }
+        }
+
+        payloadWriter.align();
+
+        std::string payloadData = payload.str();
+        std::stringstream element(std::stringstream::in | std::stringstream::out | std::stringstream::binary);
+        BitStreamWriterT<std::ostream> elementWriter(element);
+
+        write(elementWriter, Plex<8>(kIABElementID_AudioDataDLC));
+        write(elementWriter, Plex<8>(static_cast<uint32_t>(payloadData.size())));
+        elementWriter.write(reinterpret_cast<const uint8_t*>(payloadData.data()), static_cast<uint32_t>(payloadData.size()));
+        elementWriter.align();
+
+        oElement.data_ = element.str();
+    }
+
+    // Parse an element of PCM coded sub-blocks field by field, as DeSerialize() did before word unpacking
+    bool ReferenceParse(BufferReader &ioReader, std::vector<int32_t> &oResiduals)
+    {
+        Plex<8> plex8Field = 0;
+        uint16_t dlcSize = 0;
+        uint8_t field = 0;
+
+        oResiduals.clear();
+
+        // ElementID, ElementSize, AudioDataID, DLCSize, SampleRate, ShiftBits, NumPredRegions48
+        if (OK != read(ioReader, plex8Field) || OK != read(ioReader, plex8Field) || OK != read(ioReader, plex8Field) ||
+            OK != ioReader.read(dlcSize) || OK != ioReader.read(field, 2) || OK != ioReader.read(field, 5) ||
+            OK != ioReader.read(field, 2))
+        {
+            return false;
+        }
+
+        for (uint32_t n = 0; n < kSubBlockCount; n++)
+        {
+            uint8_t bitDepth = 0;
+
+            if (OK != ioReader.read(field, 1) || OK != ioReader.read(bitDepth, 5))
+            {
+                return false;
+            }
+
+            for (uint32_t i = 0; i < kSubBlockLength; i++)
+            {
+                int32_t residualValue = 0;
+                uint8_t residualSign = 0;
+
+                if (OK != ioReader.read(residualValue, bitDepth))
+                {
+                    return false;
+                }
+
+                if (residualValue != 0)
+                {
+                    if (OK != ioReader.read(residualSign, 1))
+                    {
+                        return false;
+                    }
+
+                    if (residualSign == 1)
+                    {
+                        residualValue *= -1;
+                    }
+                }
+
+                oResiduals.push_back(residualValue);
+            }
+        }
+
+        // Byte alignment
+        return OK == ioReader.align();
+    }
+
+    // Parse and decode whole elements, check the samples against the encoded and reference parsed residuals
+    bool CheckElements(std::vector<bool> &ioPhases)
+    {
+        std::vector<int32_t> samples(kSampleCount);
+
+        for (uint32_t i = 0; i < 200; i++)
+        {
+            DLCElement element;
+            std::vector<int32_t> referenceResiduals;
+
+            MakeElement(element, ioPhases);
+
+            BufferReader referenceReader(element.data_.data(), static_cast<BitCount_t>(element.data_.size()));
+
+            if (!ReferenceParse(referenceReader, referenceResiduals) || referenceResiduals != element.residuals_)
+            {
+                printf("Element %u: reference parse does not return the encoded residuals\n", i);
+
+                return false;
+            }
+
+            iabError constructionError = kIABNoError;
+            IABAudioDataDLC audioData(kIABFrameRate_24FPS, kIABSampleRate_48000Hz, constructionError);
+            BufferReader reader(element.data_.data(), static_cast<BitCount_t>(element.data_.size()));
+
+            if (kIABNoError != audioData.DeSerialize(reader))
+            {
+                printf("Element %u: DeSerialize() fails\n", i);
+
+                return false;
+            }
+
+            if (reader.bitCount() != referenceReader.bitCount())
+            {
+                printf("Element %u: DeSerialize() stops at bit %u, reference parse at bit %u\n", i,
+                    static_cast<uint32_t>(reader.bitCount()), static_cast<uint32_t>(referenceReader.bitCount()));
+
+                return false;
+            }
+
+            if (kIABNoError != audioData.DecodeDLCToMonoPCM(&samples[0], kSampleCount, kIABSampleRate_48000Hz) ||
+                samples != element.residuals_)
+            {
+                printf("Element %u: decoded samples are not the encoded residuals\n", i);
+
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    // Elements cut short, within a sub-block or between sub-blocks, fail where the reference parse fails
+    bool CheckTruncated(std::vector<bool> &ioPhases)
+    {
+        for (uint32_t i = 0; i < 1000; i++)
+        {
+            DLCElement element;
+            std::vector<int32_t> referenceResiduals;
+
+            MakeElement(element, ioPhases);
+
+            // Keep at least the element header, the element size field is not checked against the buffer
+            size_t cutSize = 12 + Random() % (element.data_.size() - 12);
+
+            element.data_.resize(cutSize);
+
+            BufferReader referenceReader(element.data_.data(), static_cast<BitCount_t>(element.data_.size()));
+            bool referenceParsed = ReferenceParse(referenceReader, referenceResiduals);
+
+            iabError constructionError = kIABNoError;
+            IABAudioDataDLC audioData(kIABFrameRate_24FPS, kIABSampleRate_48000Hz, constructionError);
+            BufferReader reader(element.data_.data(), static_cast<BitCount_t>(element.data_.size()));
+            iabError errorCode = audioData.DeSerialize(reader);
+
+            if ((errorCode == kIABNoError) != referenceParsed)
+            {
+                printf("Element cut to %u bytes: DeSerialize() returns %d, reference parse %s\n",
+                    static_cast<uint32_t>(cutSize), errorCode, referenceParsed ? "succeeds" : "fails");
+
+                return false;
+            }
+
+            if (reader.bitCount() != referenceReader.bitCount())
+            {
+                printf("Element cut to %u bytes: DeSerialize() stops at bit %u, reference parse at bit %u\n",
+                    static_cast<uint32_t>(cutSize), static_cast<uint32_t>(reader.bitCount()),
+                    static_cast<uint32_t>(referenceReader.bitCount()));
+
+                return false;
+            }
+        }
+
+        return true;
+    }
+}
+
+int main()
+{
+    std::vector<bool> phases(8, false);
+
+    bool passed = CheckElements(phases) && CheckTruncated(phases);
+
+    for (uint32_t phase = 0; passed && phase < 8; phase++)
+    {
+        if (!phases[phase])
+        {
+            printf("No sub-block starts at bit phase %u\n", phase);
+            passed = false;
+        }
+    }
+
+    printf("%s\n", passed ? "Passed" : "Failed");
+
+    return passed ? 0 : 1;
+}
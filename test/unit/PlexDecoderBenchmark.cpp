@@ -0,0 +1,309 @@
+/* Copyright (c) 2020 Xperi Corporation (and its subsidiaries). All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining
+a copy of this software and associated documentation files (the "Software"),
+to deal in the Software without restriction, including without limitation
+the rights to use, copy, modify, merge, publish, distribute, sublicense,
+and/or sell copies of the Software, and to permit persons to whom the
+Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included
+in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+
+IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT
+OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR
+THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+// Micro-benchmark of the Plex<4>/Plex<8> decoder, read(BitStreamReaderT&, Plex<N>&) in BitStreamIOHelpers.h,
+// against the escape field loop it replaced.
+//
+// Both decoders run over the same streams of Plex fields, with a mix of escape levels and starting at any
+// bit phase. They must agree on every value, on the reader position, on the CRC of the bits read, and on
+// codes cut short by the end of the stream. Timings are printed for information, the test only fails on
+// a mismatch.
+
+#include <stdint.h>
+#include <cstdio>
+#include <ctime>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "BitStreamReaderT.h"
+#include "BitStreamWriterT.h"
+#include "BitStreamIOHelpers.h"
+#include "RawIStream.h"
+#include "CRC16.h"
+
+using namespace CommonStream;
+
+typedef BitStreamReaderT<RawIStream> BufferReader;
+
+namespace
+{
+    // Plex<N> decoder before the word lookahead: one bounded read per escape field
+    template <uint32_t N>
+    ReturnCode ReadPlexEscapeLoop(BufferReader& bsr, Plex<N> &oVal)
+    {
+        ReturnCode rc = OK;
+
+        oVal = 0;
+        uint32_t bitsToRead = N;
+        uint32_t value = 0;
+
+        while (bitsToRead <= 32)
+        {
+            rc = bsr.read(value, bitsToRead);
+
+            if (rc != OK)
+            {
+                return rc;
+            }
+
+            uint64_t maxValue = 1;
+            maxValue = (maxValue << bitsToRead) - 1;
+
+            if (value < maxValue)
+            {
+                oVal = value;
+
+                return OK;
+            }
+
+            bitsToRead = bitsToRead << 1;
+        }
+
+        return PARAMS_BAD;
+    }
+
+    uint32_t randomState = 12345;
+
+    uint32_t Random()
+    {
+        randomState = randomState * 1103515245u + 12345u;
+
+        return randomState >> 8;
+    }
+
+    // Plex fields, each preceded by a 0 to 7 bit gap field so that codes start at any bit phase
+    struct PlexStream
+    {
+        std::string data_;
+        std::vector<uint32_t> values_;
+        std::vector<uint8_t> gaps_;
+    };
+
+    // Make a stream of iCount fields. iEscapePercent of them escape to a wider value field.
+    template <uint32_t N>
+    void MakeStream(PlexStream &oStream, uint32_t iCount, uint32_t iEscapePercent)
+    {
+        std::stringstream buffer(std::stringstream::in | std::stringstream::out | std::stringstream::binary);
+        BitStreamWriterT<std::ostream> writer(buffer);
+
+        oStream.values_.clear();
+        oStream.gaps_.clear();
+
+        for (uint32_t i = 0; i < iCount; i++)
+        {
+            uint32_t value = Random() % ((1u << N) - 1);
+
+            if ((Random() % 100) < iEscapePercent)
+            {
+                // Value field of N << level bits
+                uint32_t level = 1 + Random() % (N == 4 ? 3 : 2);
+                uint32_t valueBits = N << level;
+
+                value = (Random() << 8) ^ Random();
+
+                if (valueBits < 32)
+                {
+                    value %= (1u << valueBits) - 1;
+                }
+                else if (value == 0xFFFFFFFFu)
+                {
+                    value--;
+                }
+            }
+
+            uint8_t gap = static_cast<uint8_t>(Random() % 8);
+
+            if (gap > 0)
+            {
+                writer.write(static_cast<uint8_t>(Random()), gap);
+            }
+
+            write(writer, Plex<N>(value));
+
+            oStream.values_.push_back(value);
+            oStream.gaps_.push_back(gap);
+        }
+
+        writer.align();
+        oStream.data_ = buffer.str();
+    }
+
+    // Decode all fields of iStream, with the word lookahead decoder or the escape loop. With iUseCRC, the
+    // CRC of the bits read is accumulated into oCRC.
+    template <uint32_t N>
+    ReturnCode DecodeStream(const PlexStream &iStream, bool iEscapeLoop, bool iUseCRC, std::vector<uint32_t> &oValues, uint16_t &oCRC, BitCount_t &oBitCount)
+    {
+        BufferReader reader(iStream.data_.data(), static_cast<BitCount_t>(iStream.data_.size()));
+        CRC16Generator crc;
+        ReturnCode rc = OK;
+
+        if (iUseCRC)
+        {
+            reader.setCRCGenerator(&crc);
+            crc.start();
+        }
+
+        oValues.resize(iStream.values_.size());
+
+        for (size_t i = 0; i < iStream.values_.size() && rc == OK; i++)
+        {
+            Plex<N> field = 0;
+
+            if (iStream.gaps_[i] > 0)
+            {
+                reader.skip(iStream.gaps_[i]);
+            }
+
+            rc = iEscapeLoop ? ReadPlexEscapeLoop(reader, field) : read(reader, field);
+            oValues[i] = static_cast<uint32_t>(field);
+        }
+
+        oCRC = 0;
+        oBitCount = reader.bitCount();
+
+        if (iUseCRC)
+        {
+            uint8_t crcRegister[2] = { 0, 0 };
+
+            crc.getCRCRegister(crcRegister);
+            oCRC = static_cast<uint16_t>((crcRegister[0] << 8) | crcRegister[1]);
+            reader.setCRCGenerator(nullptr);
+        }
+
+        return rc;
+    }
+
+    // Check both decoders against the encoded values, then time them
+    template <uint32_t N>
+    bool CheckAndTime(uint32_t iEscapePercent)
+    {
+        const uint32_t kFieldCount = 200000;
+        const uint32_t kRuns = 10;
+
+        PlexStream stream;
+
+        MakeStream<N>(stream, kFieldCount, iEscapePercent);
+
+        std::vector<uint32_t> values[2];
+        uint16_t crc[2] = { 0, 0 };
+        BitCount_t bitCount[2] = { 0, 0 };
+        double seconds[2] = { 0.0, 0.0 };
+
+        for (int decoder = 0; decoder < 2; decoder++)
+        {
+            ReturnCode rc = DecodeStream<N>(stream, decoder == 1, true, values[decoder], crc[decoder], bitCount[decoder]);
+
+            if (rc != OK || values[decoder] != stream.values_)
+            {
+                printf("Plex<%u>, %u%% escaped: %s decoder does not return the encoded values\n",
+                    N, iEscapePercent, decoder ? "escape loop" : "lookahead");
+
+                return false;
+            }
+
+            uint16_t unusedCRC = 0;
+            BitCount_t unusedBitCount = 0;
+            clock_t start = clock();
+
+            for (uint32_t run = 0; run < kRuns; run++)
+            {
+                DecodeStream<N>(stream, decoder == 1, false, values[decoder], unusedCRC, unusedBitCount);
+            }
+
+            seconds[decoder] = static_cast<double>(clock() - start) / CLOCKS_PER_SEC;
+        }
+
+        if (crc[0] != crc[1] || bitCount[0] != bitCount[1])
+        {
+            printf("Plex<%u>, %u%% escaped: CRC %04x/%04x or position %u/%u differ\n", N, iEscapePercent,
+                crc[0], crc[1], static_cast<uint32_t>(bitCount[0]), static_cast<uint32_t>(bitCount[1]));
+
+            return false;
+        }
+
+        double fieldCount = static_cast<double>(kFieldCount) * kRuns;
+
+        printf("Plex<%u>, %3u%% escaped: lookahead %6.2f ns/field, escape loop %6.2f ns/field\n", N, iEscapePercent,
+            seconds[0] * 1e9 / fieldCount, seconds[1] * 1e9 / fieldCount);
+
+        return true;
+    }
+
+    // Codes cut short by the end of the stream fail the same way with both decoders, at any bit phase
+    template <uint32_t N>
+    bool CheckTruncated()
+    {
+        for (uint32_t i = 0; i < 2000; i++)
+        {
+            PlexStream stream;
+
+            MakeStream<N>(stream, 1 + Random() % 4, 60);
+
+            size_t cutSize = Random() % stream.data_.size();
+
+            if (cutSize == 0)
+            {
+                continue;
+            }
+
+            stream.data_.resize(cutSize);
+
+            std::vector<uint32_t> values[2];
+            uint16_t crc[2] = { 0, 0 };
+            BitCount_t bitCount[2] = { 0, 0 };
+            ReturnCode rc[2];
+
+            for (int decoder = 0; decoder < 2; decoder++)
+            {
+                rc[decoder] = DecodeStream<N>(stream, decoder == 1, true, values[decoder], crc[decoder], bitCount[decoder]);
+            }
+
+            if (rc[0] != rc[1] || values[0] != values[1] || crc[0] != crc[1])
+            {
+                printf("Plex<%u>, stream cut to %u bytes: decoders return %d/%d\n", N,
+                    static_cast<uint32_t>(cutSize), rc[0], rc[1]);
+
+                return false;
+            }
+        }
+
+        return true;
+    }
+}
+
+int main()
+{
+    bool passed = CheckTruncated<4>() && CheckTruncated<8>();
+
+    uint32_t escapePercents[] = { 0, 10, 50, 100 };
+
+    for (size_t i = 0; i < sizeof(escapePercents) / sizeof(escapePercents[0]); i++)
+    {
+        passed = CheckAndTime<8>(escapePercents[i]) && passed;
+        passed = CheckAndTime<4>(escapePercents[i]) && passed;
+    }
+
+    printf("%s\n", passed ? "Passed" : "Failed");
+
+    return passed ? 0 : 1;
+}
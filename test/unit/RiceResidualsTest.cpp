@@ -0,0 +1,263 @@
+/* Copyright (c) 2020 Xperi Corporation (and its subsidiaries). All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining
+a copy of this software and associated documentation files (the "Software"),
+to deal in the Software without restriction, including without limitation
+the rights to use, copy, modify, merge, publish, distribute, sublicense,
+and/or sell copies of the Software, and to permit persons to whom the
+Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included
+in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+
+IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT
+OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR
+THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+
+// Round trip test of Rice/Golomb coded residuals, which dlc::RiceResidualsSubBlock stores as signed values.
+//
+// Residual values are set with getResiduals(), and their Rice/Golomb form read back with getRiceResidual().
+// Setting that form with setRiceResidual() must give back the values. DLC elements of Rice coded sub-blocks
+// are written from that form, then parsed and decoded with IABAudioDataDLC. Without prediction and shift,
+// the decoded samples must be the values. Sub-blocks cover RiceRemBits 0 to 31, positive and negative
+// values, zeros, quotients longer than the parser's word lookahead, and the largest magnitudes: 2^31 - 1,
+// and 2^31 read as -2^31.
+
+#include <stdint.h>
+#include <cstdio>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "IABElements.h"
+#include "BitStreamIOHelpers.h"
+
+using namespace SMPTE::ImmersiveAudioBitstream;
+using namespace CommonStream;
+
+namespace
+{
+    // 24 fps, 48 kHz DLC element: 10 sub-blocks of 200 samples
+    const uint32_t kSubBlockCount = 10;
+    const uint32_t kSubBlockLength = 200;
+    const uint32_t kSampleCount = kSubBlockCount * kSubBlockLength;
+
+    // Largest RiceRemBits, and longest quotient written
+    const uint32_t kMaxRiceRemBits = 31;
+    const uint32_t kMaxQuotient = 150;
+
+    uint32_t randomState = 86420;
+
+    uint32_t Random()
+    {
+        randomState = randomState * 1103515245u + 12345u;
+
+        return randomState >> 8;
+    }
+
+    // Random value of a sub-block of iRiceRemBits: mostly short quotients, some longer than 64 bits,
+    // magnitudes up to 2^31 - 1
+    int32_t RandomValue(uint32_t iRiceRemBits)
+    {
+        const uint32_t maxMagnitude = 0x7FFFFFFFu;
+        uint32_t maxQuotient = maxMagnitude >> iRiceRemBits;
+        uint32_t quotient = ((Random() % 8) == 0) ? Random() % (kMaxQuotient + 1) : Random() % 4;
+        uint32_t remainder = (iRiceRemBits == 0) ? 0 : (Random() & ((1u << iRiceRemBits) - 1));
+
+        if ((Random() % 10) == 0)
+        {
+            return 0;
+        }
+
+        if (quotient >= maxQuotient)
+        {
+            quotient = maxQuotient;
+            remainder &= maxMagnitude - (quotient << iRiceRemBits);
+        }
+
+        uint32_t magnitude = (quotient << iRiceRemBits) + remainder;
+
+        return (Random() & 1) ? -static_cast<int32_t>(magnitude) : static_cast<int32_t>(magnitude);
+    }
+
+    // Fill ioSubBlock with random values, setting the largest magnitudes in sub-blocks of the largest RiceRemBits
+    void SetValues(dlc::RiceResidualsSubBlock &ioSubBlock)
+    {
+        uint32_t riceRemBits = ioSubBlock.getRiceRemBits();
+        int32_t *values = ioSubBlock.getResiduals();
+
+        for (uint32_t i = 0; i < ioSubBlock.getSize(); i++)
+        {
+            values[i] = RandomValue(riceRemBits);
+        }
+
+        if (riceRemBits == kMaxRiceRemBits)
+        {
+            values[Random() % ioSubBlock.getSize()] = 0x7FFFFFFF;
+            values[Random() % ioSubBlock.getSize()] = -0x7FFFFFFF;
+            values[Random() % ioSubBlock.getSize()] = static_cast<int32_t>(0x80000000u);
+        }
+    }
+
+    // Check that the Rice/Golomb form of the values of iSubBlock gives them back
+    bool CheckRiceForm(const dlc::RiceResidualsSubBlock &iSubBlock)
+    {
+        dlc::RiceResidualsSubBlock subBlock(iSubBlock.getSize());
+
+        subBlock.setRiceRemBits(iSubBlock.getRiceRemBits());
+
+        for (uint32_t i = 0; i < iSubBlock.getSize(); i++)
+        {
+            dlc::RiceResidual residual = iSubBlock.getRiceResidual(i);
+
+            if ((residual.getRemainder() < 0) || ((iSubBlock.getRiceRemBits() < 31) && (residual.getRemainder() >= (1 << iSubBlock.getRiceRemBits()))))
+            {
+                printf("RiceRemBits %u: value %d has remainder %d\n", iSubBlock.getRiceRemBits(), iSubBlock.getResiduals()[i], residual.getRemainder());
+
+                return false;
+            }
+
+            subBlock.setRiceResidual(i, residual);
+
+            if (subBlock.getResiduals()[i] != iSubBlock.getResiduals()[i])
+            {
+                printf("RiceRemBits %u: value %d is set back as %d\n", iSubBlock.getRiceRemBits(), iSubBlock.getResiduals()[i], subBlock.getResiduals()[i]);
+
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    // Write the residuals of iSubBlock in Rice/Golomb form: unary quotient closed by a 0, RiceRemBits wide
+    // remainder, and a sign bit unless both are zero
+    void WriteSubBlock(BitStreamWriterT<std::ostream> &ioWriter, const dlc::RiceResidualsSubBlock &iSubBlock)
+    {
+        uint8_t riceRemBits = iSubBlock.getRiceRemBits();
+
+        ioWriter.write(static_cast<uint8_t>(dlc::eCodeType_RICE_CODE_TYPE), 1);
+        ioWriter.write(riceRemBits, 5);
+
+        for (uint32_t i = 0; i < iSubBlock.getSize(); i++)
+        {
+            dlc::RiceResidual residual = iSubBlock.getRiceResidual(i);
+            uint32_t quotient = static_cast<uint32_t>(residual.getQuotient());
+            uint32_t remainder = static_cast<uint32_t>(residual.getRemainder());
+
+            for (uint32_t n = 0; n < quotient; n++)
+            {
+                ioWriter.write(true);
+            }
+
+            ioWriter.write(false);
+
+            if (riceRemBits != 0)
+            {
+                ioWriter.write(remainder, riceRemBits);
+            }
+
+            if ((quotient != 0) || (remainder != 0))
+            {
+                ioWriter.write(residual.getSign() < 0);
+            }
+        }
+    }
+
+    // Make an element of Rice coded sub-blocks of RiceRemBits iFirstRiceRemBits and up, with its values
+    bool MakeElement(uint32_t iFirstRiceRemBits, std::string &oData, std::vector<int32_t> &oValues)
+    {
+        std::stringstream payload(std::stringstream::in | std::stringstream::out | std::stringstream::binary);
+        BitStreamWriterT<std::ostream> payloadWriter(payload);
+        bool passed = true;
+
+        oValues.clear();
+
+        // AudioDataID, DLCSize, SampleRate (48 kHz), ShiftBits, NumPredRegions48
+        write(payloadWriter, Plex<8>(1 + Random() % 200));
+        payloadWriter.write(static_cast<uint16_t>(0));
+        payloadWriter.write(static_cast<uint8_t>(0), 2);
+        payloadWriter.write(static_cast<uint8_t>(0), 5);
+        payloadWriter.write(static_cast<uint8_t>(0), 2);
+
+        for (uint32_t n = 0; n < kSubBlockCount; n++)
+        {
+            dlc::RiceResidualsSubBlock subBlock(kSubBlockLength);
+
+            subBlock.setRiceRemBits(static_cast<dlc::uint5_t>((iFirstRiceRemBits + n) % (kMaxRiceRemBits + 1)));
+            SetValues(subBlock);
+
+            passed = CheckRiceForm(subBlock) && passed;
+
+            WriteSubBlock(payloadWriter, subBlock);
+            oValues.insert(oValues.end(), subBlock.getResiduals(), subBlock.getResiduals() + subBlock.getSize());
+        }
+
+        payloadWriter.align();
+
+        std::string payloadData = payload.str();
+        std::stringstream element(std::stringstream::in | std::stringstream::out | std::stringstream::binary);
+        BitStreamWriterT<std::ostream> elementWriter(element);
+
+        write(elementWriter, Plex<8>(kIABElementID_AudioDataDLC));
+        write(elementWriter, Plex<8>(static_cast<uint32_t>(payloadData.size())));
+        elementWriter.write(reinterpret_cast<const uint8_t*>(payloadData.data()), static_cast<uint32_t>(payloadData.size()));
+        elementWriter.align();
+
+        oData = element.str();
+
+        return passed;
+    }
+}
+
+int main()
+{
+    std::vector<int32_t> samples(kSampleCount);
+    bool passed = true;
+
+    // Sub-blocks of each element take the next RiceRemBits, every RiceRemBits is met at every sub-block index
+    for (uint32_t i = 0; passed && (i < 4 * (kMaxRiceRemBits + 1)); i++)
+    {
+        std::string data;
+        std::vector<int32_t> values;
+
+        if (!MakeElement(i % (kMaxRiceRemBits + 1), data, values))
+        {
+            passed = false;
+            break;
+        }
+
+        iabError constructionError = kIABNoError;
+        IABAudioDataDLC audioData(kIABFrameRate_24FPS, kIABSampleRate_48000Hz, constructionError);
+        BufferReader reader(data.data(), static_cast<BitCount_t>(data.size()));
+
+        if (kIABNoError != audioData.DeSerialize(reader))
+        {
+            printf("Element %u: DeSerialize() fails\n", i);
+            passed = false;
+        }
+        else if (reader.bitCount() != data.size() * 8)
+        {
+            printf("Element %u: DeSerialize() stops at bit %u of %u\n", i,
+                static_cast<uint32_t>(reader.bitCount()), static_cast<uint32_t>(data.size() * 8));
+            passed = false;
+        }
+        else if (kIABNoError != audioData.DecodeDLCToMonoPCM(&samples[0], kSampleCount, kIABSampleRate_48000Hz) ||
+            samples != values)
+        {
+            printf("Element %u: decoded samples are not the encoded values\n", i);
+            passed = false;
+        }
+    }
+
+    printf("%s\n", passed ? "Passed" : "Failed");
+
+    return passed ? 0 : 1;
+}
@@ -0,0 +1,220 @@
+/* Copyright (c) 2020 Xperi Corporation (and its subsidiaries). All rights reserved.
+
+Permission is hereby granted, free of charge, to any person obtaining
+a copy of this software and associated documentation files (the "Software"),
+to deal in the Software without restriction, including without limitation
+the rights to use, copy, modify, merge, publish, distribute, sublicense,
+and/or sell copies of the Software, and to permit persons to whom the
+Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included
+in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+
+IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT
+OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR
+THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+// Unit test of the skipping of bed and object sub-elements that are not parsed.
+//
+// A frame holds a bed with a bed sub-element, an object with an object sub-element, then a last object.
+// The element ID of the bed sub-element is changed to one not allowed in a bed, and the element ID of the
+// object sub-element to an undefined one. Both must be skipped and counted, and the last object must still
+// be parsed.
+
+#include <stdint.h>
+#include <cstdio>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "IABElements.h"
+#include "IABParserAPI.h"
+
+using namespace SMPTE::ImmersiveAudioBitstream;
+
+namespace
+{
+    // Element IDs patched in, both one byte Plex<8> codes like those they replace
+    const uint8_t kUnallowedBedSubElementID = kIABElementID_IAFrame;
+    const uint8_t kUndefinedObjectSubElementID = 0x30;
+
+    const IABMetadataIDType kLastObjectID = 5;
+
+    // Pack iElement on its own
+    std::string PackElement(IABElement *iElement)
+    {
+        std::stringstream elementStream(std::stringstream::in | std::stringstream::out | std::stringstream::binary);
+
+        iElement->Serialize(elementStream);
+
+        return elementStream.str();
+    }
+
+    // Object of iMetadataID, with a position in each of its pan sub-blocks
+    IABObjectDefinition* MakeObject(IABMetadataIDType iMetadataID)
+    {
+        IABObjectDefinition *object = dynamic_cast<IABObjectDefinition*>(IABObjectDefinitionInterface::Create(kIABFrameRate_24FPS));
+        std::vector<IABObjectSubBlock*> subBlocks;
+        uint8_t subBlockCount = 0;
+
+        object->SetMetadataID(iMetadataID);
+        object->SetAudioDataID(0);
+        object->GetNumPanSubBlocks(subBlockCount);
+
+        for (uint8_t n = 0; n < subBlockCount; n++)
+        {
+            IABObjectSubBlock *subBlock = dynamic_cast<IABObjectSubBlock*>(IABObjectSubBlockInterface::Create());
+            CartesianPosInUnitCube position;
+
+            position.setIABObjectPosition(0.5f, 0.1f * iMetadataID, 0.1f * n);
+            subBlock->SetPanInfoExists(true);
+            subBlock->SetObjectPositionFromUnitCube(position);
+            subBlocks.push_back(subBlock);
+        }
+
+        object->SetPanSubBlocks(subBlocks);
+
+        return object;
+    }
+
+    // Replace the element ID of the packed iSubElement, found once in ioData, with iElementID
+    bool PatchElementID(std::string &ioData, const std::string &iSubElement, uint8_t iElementID)
+    {
+        size_t position = ioData.find(iSubElement);
+
+        if ((position == std::string::npos) || (ioData.find(iSubElement, position + 1) != std::string::npos))
+        {
+            return false;
+        }
+
+        ioData[position] = static_cast<char>(iElementID);
+
+        return true;
+    }
+
+    // Pack a 24 fps, 48 kHz frame of a bed and two objects, the first bed and object each with a
+    // sub-element, then patch the element IDs of those sub-elements
+    bool MakeFrame(std::string &oData)
+    {
+        IABFrameInterface *frame = IABFrameInterface::Create(nullptr);
+        IABBedDefinition *bed = dynamic_cast<IABBedDefinition*>(IABBedDefinitionInterface::Create(kIABFrameRate_24FPS));
+        IABBedDefinition *subBed = dynamic_cast<IABBedDefinition*>(IABBedDefinitionInterface::Create(kIABFrameRate_24FPS));
+        IABObjectDefinition *object = MakeObject(3);
+        IABObjectDefinition *subObject = MakeObject(4);
+        std::vector<IABElement*> subElements;
+
+        frame->SetSampleRate(kIABSampleRate_48000Hz);
+        frame->SetFrameRate(kIABFrameRate_24FPS);
+        frame->SetMaxRendered(3);
+
+        bed->SetMetadataID(1);
+        subBed->SetMetadataID(2);
+        subElements.push_back(subBed);
+        bed->SetSubElements(subElements);
+
+        subElements.clear();
+        subElements.push_back(subObject);
+        object->SetSubElements(subElements);
+
+        std::string packedSubBed = PackElement(subBed);
+        std::string packedSubObject = PackElement(subObject);
+
+        subElements.clear();
+        subElements.push_back(bed);
+        subElements.push_back(object);
+        subElements.push_back(MakeObject(kLastObjectID));
+        frame->SetSubElements(subElements);
+
+        std::stringstream frameStream(std::stringstream::in | std::stringstream::out | std::stringstream::binary);
+        bool packed = (kIABNoError == frame->Serialize(frameStream));
+
+        oData = frameStream.str();
+        IABFrameInterface::Delete(frame);
+
+        return packed && PatchElementID(oData, packedSubBed, kUnallowedBedSubElementID) &&
+            PatchElementID(oData, packedSubObject, kUndefinedObjectSubElementID);
+    }
+}
+
+int main()
+{
+    std::string frameData;
+    bool passed = MakeFrame(frameData);
+
+    std::stringstream frameStream(frameData, std::stringstream::in | std::stringstream::binary);
+    IABParserInterface *parser = IABParserInterface::Create(&frameStream);
+    const IABFrameInterface *frame = nullptr;
+    std::vector<IABElement*> subElements;
+
+    if (!passed)
+    {
+        printf("Frame cannot be made\n");
+    }
+    else if ((kIABNoError != parser->ParseIABFrame()) || (kIABNoError != parser->GetIABFrame(frame)))
+    {
+        printf("Frame cannot be parsed\n");
+        passed = false;
+    }
+    else
+    {
+        frame->GetSubElements(subElements);
+    }
+
+    if (passed && (subElements.size() != 3))
+    {
+        printf("Frame parsed with %u sub-elements, expected 3\n", static_cast<uint32_t>(subElements.size()));
+        passed = false;
+    }
+
+    if (passed)
+    {
+        IABBedDefinition *bed = dynamic_cast<IABBedDefinition*>(subElements[0]);
+        IABObjectDefinition *object = dynamic_cast<IABObjectDefinition*>(subElements[1]);
+        IABObjectDefinition *lastObject = dynamic_cast<IABObjectDefinition*>(subElements[2]);
+        IABMetadataIDType lastObjectID = 0;
+        std::vector<IABElement*> bedSubElements;
+        std::vector<IABElement*> objectSubElements;
+
+        if (!bed || !object || !lastObject)
+        {
+            printf("Frame sub-elements parsed with other types\n");
+            passed = false;
+        }
+        else
+        {
+            bed->GetSubElements(bedSubElements);
+            object->GetSubElements(objectSubElements);
+            lastObject->GetMetadataID(lastObjectID);
+        }
+
+        if (passed && (!bedSubElements.empty() || (bed->GetNumUnallowedSubElements() != 1)))
+        {
+            printf("Bed sub-element not allowed in a bed is not skipped\n");
+            passed = false;
+        }
+
+        if (passed && (!objectSubElements.empty() || (object->GetNumUndefinedSubElements() != 1)))
+        {
+            printf("Undefined object sub-element is not skipped\n");
+            passed = false;
+        }
+
+        if (passed && (lastObjectID != kLastObjectID))
+        {
+            printf("Last object parsed with MetadataID %u, expected %u\n", lastObjectID, kLastObjectID);
+            passed = false;
+        }
+    }
+
+    IABParserInterface::Delete(parser);
+
+    printf("%s\n", passed ? "Passed" : "Failed");
+
+    return passed ? 0 : 1;
+}